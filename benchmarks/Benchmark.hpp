@@ -0,0 +1,212 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <TGUI/TGUI.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    /// Amount of allocations and allocated bytes since the start of the program, counted by the replaced operator new
+    std::size_t getAllocationCount();
+    std::size_t getAllocatedBytes();
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Passed to a benchmark to control which part of it gets measured
+    ///
+    /// Only the code inside the keepRunning loop is measured, the code before the loop can be used for the setup:
+    /// @code
+    /// BENCHMARK("Button/draw")
+    /// {
+    ///     auto button = tgui::Button::create("Text");
+    ///     while (state.keepRunning())
+    ///         drawWidget(button);
+    /// }
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class State
+    {
+    public:
+
+        explicit State(std::size_t iterations) :
+            m_iterations(iterations),
+            m_remaining (iterations)
+        {
+        }
+
+        // Returns true as long as the measured code has to be executed again
+        bool keepRunning()
+        {
+            if (!m_started)
+            {
+                m_started = true;
+                resumeTiming();
+            }
+
+            if (m_remaining == 0)
+            {
+                pauseTiming();
+                return false;
+            }
+
+            --m_remaining;
+            return true;
+        }
+
+        // Excludes the code between pauseTiming and resumeTiming from the measurement
+        void pauseTiming()
+        {
+            if (!m_running)
+                return;
+
+            m_elapsed += std::chrono::steady_clock::now() - m_startTime;
+            m_allocations += getAllocationCount() - m_startAllocations;
+            m_allocatedBytes += getAllocatedBytes() - m_startAllocatedBytes;
+            m_running = false;
+        }
+
+        void resumeTiming()
+        {
+            if (m_running)
+                return;
+
+            m_running = true;
+            m_startAllocations = getAllocationCount();
+            m_startAllocatedBytes = getAllocatedBytes();
+            m_startTime = std::chrono::steady_clock::now();
+        }
+
+        std::size_t getIterations() const
+        {
+            return m_iterations;
+        }
+
+        std::chrono::steady_clock::duration getElapsedTime() const
+        {
+            return m_elapsed;
+        }
+
+        std::size_t getAllocations() const
+        {
+            return m_allocations;
+        }
+
+        std::size_t getAllocatedBytes() const
+        {
+            return m_allocatedBytes;
+        }
+
+    private:
+
+        std::size_t m_iterations;
+        std::size_t m_remaining;
+        bool m_started = false;
+        bool m_running = false;
+
+        std::chrono::steady_clock::time_point m_startTime;
+        std::chrono::steady_clock::duration m_elapsed{0};
+
+        std::size_t m_startAllocations = 0;
+        std::size_t m_startAllocatedBytes = 0;
+        std::size_t m_allocations = 0;
+        std::size_t m_allocatedBytes = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Benchmark
+    {
+        std::string name;
+        std::function<void(State&)> function;
+    };
+
+    std::vector<Benchmark>& getBenchmarks();
+
+    inline void addBenchmark(const std::string& name, const std::function<void(State&)>& function)
+    {
+        getBenchmarks().push_back({name, function});
+    }
+
+    // Adds benchmarks when the program starts
+    struct Registrar
+    {
+        Registrar(const std::string& name, void(*function)(State&))
+        {
+            addBenchmark(name, function);
+        }
+
+        Registrar(void(*registerFunction)())
+        {
+            registerFunction();
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Offscreen target that all benchmarks draw to, so that no window is needed
+    sf::RenderTexture& getRenderTexture();
+
+    // Font that is given to every gui, loaded once from the fonts folder
+    std::shared_ptr<sf::Font> getFont();
+
+    // Draws the gui once and waits until the commands have been submitted
+    void drawGui(tgui::Gui& gui);
+
+    // Prevents the compiler from optimizing away a value that isn't used
+    template <typename T>
+    void doNotOptimize(const T& value)
+    {
+        volatile const void* pointer = &value;
+        (void)pointer;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+/// Defines a benchmark with a fixed name
+#define BENCHMARK(name) \
+    static void BENCHMARK_CONCAT(benchmark_, __LINE__)(bench::State& state); \
+    static bench::Registrar BENCHMARK_CONCAT(registrar_, __LINE__){name, &BENCHMARK_CONCAT(benchmark_, __LINE__)}; \
+    static void BENCHMARK_CONCAT(benchmark_, __LINE__)(bench::State& state)
+
+/// Defines a function that adds benchmarks with bench::addBenchmark, for benchmarks that take parameters
+#define BENCHMARK_GROUP() \
+    static void BENCHMARK_CONCAT(benchmarkGroup_, __LINE__)(); \
+    static bench::Registrar BENCHMARK_CONCAT(registrar_, __LINE__){&BENCHMARK_CONCAT(benchmarkGroup_, __LINE__)}; \
+    static void BENCHMARK_CONCAT(benchmarkGroup_, __LINE__)()
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARK_HPP
@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Containers with many children and deeply nested containers
+
+#include "Benchmark.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // ClickableWidget is the cheapest widget that still has a size and reacts to the mouse,
+    // which keeps the memory usage reasonable with a hundred thousand children
+    void addChildren(tgui::Gui& gui, unsigned int count)
+    {
+        const unsigned int columns = 1000;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({10, 10});
+            widget->setPosition((i % columns) * 12.f, (i / columns) * 12.f);
+            gui.add(widget, "Widget" + tgui::to_string(i));
+        }
+    }
+
+    // Creates panels that are each placed inside the previous one and returns the innermost panel
+    tgui::Panel::Ptr addNestedPanels(tgui::Gui& gui, unsigned int depth)
+    {
+        auto parent = tgui::Panel::create({800, 600});
+        gui.add(parent);
+
+        for (unsigned int i = 1; i < depth; ++i)
+        {
+            auto panel = tgui::Panel::create({800, 600});
+            parent->add(panel);
+            parent = panel;
+        }
+
+        parent->add(tgui::Button::create("Button"));
+        return parent;
+    }
+
+    sf::Event makeMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_GROUP()
+{
+    for (const unsigned int count : {10u, 1000u, 100000u})
+    {
+        const std::string prefix = "Container/" + tgui::to_string(count) + "/";
+
+        bench::addBenchmark(prefix + "add", [count](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            while (state.keepRunning())
+            {
+                addChildren(gui, count);
+
+                state.pauseTiming();
+                gui.removeAllWidgets();
+                state.resumeTiming();
+            }
+        });
+
+        bench::addBenchmark(prefix + "draw", [count](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            addChildren(gui, count);
+            while (state.keepRunning())
+                bench::drawGui(gui);
+        });
+
+        bench::addBenchmark(prefix + "mouseMoved", [count](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            addChildren(gui, count);
+
+            // Move between two children, so that the hovered widget changes with every event
+            const sf::Event events[] = {makeMouseMoveEvent(5, 5), makeMouseMoveEvent(17, 5)};
+            std::size_t index = 0;
+            while (state.keepRunning())
+            {
+                gui.handleEvent(events[index]);
+                index = 1 - index;
+            }
+        });
+
+        bench::addBenchmark(prefix + "get", [count](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            addChildren(gui, count);
+
+            // The widget that was added last is the worst case for a search by name
+            const sf::String name = "Widget" + tgui::to_string(count - 1);
+            while (state.keepRunning())
+                bench::doNotOptimize(gui.get(name));
+        });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/Nested100/draw")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    addNestedPanels(gui, 100);
+
+    while (state.keepRunning())
+        bench::drawGui(gui);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/Nested100/mouseMoved")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    addNestedPanels(gui, 100);
+
+    // The button in the innermost panel lies at the top left, the event travels through all panels to reach it
+    const sf::Event events[] = {makeMouseMoveEvent(10, 10), makeMouseMoveEvent(500, 500)};
+    std::size_t index = 0;
+    while (state.keepRunning())
+    {
+        gui.handleEvent(events[index]);
+        index = 1 - index;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Container/Nested100/get")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    auto innermost = addNestedPanels(gui, 100);
+    innermost->add(tgui::ClickableWidget::create(), "Target");
+
+    while (state.keepRunning())
+        bench::doNotOptimize(gui.get("Target", true));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_GROUP()
+{
+    for (const bool pooled : {false, true})
+    {
+        bench::addBenchmark(std::string{"Container/5000Buttons/createAndDestroy"} + (pooled ? "Pooled" : ""), [pooled](bench::State& state)
+        {
+            tgui::MemoryPool::setEnabled(pooled);
+            while (state.keepRunning())
+            {
+                auto panel = tgui::Panel::create({800, 600});
+                for (unsigned int i = 0; i < 5000; ++i)
+                {
+                    auto button = tgui::Button::create("Button");
+                    button->setPosition((i % 50) * 16.f, (i / 50) * 6.f);
+                    panel->add(button);
+                }
+            }
+
+            tgui::MemoryPool::setEnabled(false);
+        });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Loading themes, textures and widget files
+
+#include "Benchmark.hpp"
+
+#include <cstdio>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/Black")
+{
+    while (state.keepRunning())
+    {
+        auto theme = tgui::Theme::create("widgets/Black.txt");
+        bench::doNotOptimize(theme->load("Button"));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Theme/BlackAllWidgets")
+{
+    const std::string classNames[] = {"Button", "ChatBox", "CheckBox", "ChildWindow", "ComboBox", "EditBox", "Knob",
+                                      "Label", "ListBox", "MenuBar", "MessageBox", "ProgressBar", "RadioButton",
+                                      "Scrollbar", "Slider", "SpinButton", "Tab", "TextBox"};
+
+    while (state.keepRunning())
+    {
+        auto theme = tgui::Theme::create("widgets/Black.txt");
+        for (const auto& className : classNames)
+            bench::doNotOptimize(theme->load(className));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/Texture")
+{
+    while (state.keepRunning())
+    {
+        tgui::Texture texture{"widgets/Black.png", {0, 64, 45, 50}, {10, 0, 25, 50}};
+        bench::doNotOptimize(texture);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/WidgetFile/saveAndLoad")
+{
+    const std::string filename = "BenchmarkWidgetFile.txt";
+
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto theme = tgui::Theme::create("widgets/Black.txt");
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        tgui::Button::Ptr button = theme->load("Button");
+        button->setText("Button " + tgui::to_string(i));
+        button->setPosition(10, i * 30.f);
+        gui.add(button, "Button" + tgui::to_string(i));
+
+        tgui::EditBox::Ptr editBox = theme->load("EditBox");
+        editBox->setText("Text " + tgui::to_string(i));
+        editBox->setPosition(200, i * 30.f);
+        gui.add(editBox, "EditBox" + tgui::to_string(i));
+    }
+
+    while (state.keepRunning())
+    {
+        gui.saveWidgetsToFile(filename);
+        gui.removeAllWidgets();
+        gui.loadWidgetsFromFile(filename);
+    }
+
+    std::remove(filename.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
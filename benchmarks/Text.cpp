@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Setting long texts and adding lines or items to text widgets
+
+#include "Benchmark.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Text of words with different lengths and a newline now and then, similar to a paragraph of real text
+    sf::String createLongText(std::size_t length)
+    {
+        const std::string words[] = {"lorem", "ipsum", "a", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit."};
+
+        std::string text;
+        std::size_t i = 0;
+        while (text.size() < length)
+        {
+            text += words[i % 9];
+            text += ((i % 37) == 36) ? '\n' : ' ';
+            ++i;
+        }
+
+        text.resize(length);
+        return text;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/Label/setText100k")
+{
+    const sf::String texts[] = {createLongText(100000), createLongText(99999)};
+
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto label = tgui::Label::create();
+    label->setMaximumTextWidth(800);
+    gui.add(label);
+
+    // Alternate between two texts, so that the layout of the previous call can't be reused
+    std::size_t index = 0;
+    while (state.keepRunning())
+    {
+        state.pauseTiming();
+        tgui::TextLayoutCache::clear();
+        state.resumeTiming();
+
+        label->setText(texts[index]);
+        index = 1 - index;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/Label/setTextCached")
+{
+    const sf::String texts[] = {createLongText(1000), createLongText(999)};
+
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto label = tgui::Label::create();
+    label->setMaximumTextWidth(400);
+    gui.add(label);
+
+    std::size_t index = 0;
+    while (state.keepRunning())
+    {
+        label->setText(texts[index]);
+        index = 1 - index;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/Label/draw10k")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto label = tgui::Label::create();
+    label->setMaximumTextWidth(1000);
+    label->setText(createLongText(10000));
+    gui.add(label);
+
+    while (state.keepRunning())
+        bench::drawGui(gui);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/TextBox/setText100k")
+{
+    const sf::String texts[] = {createLongText(100000), createLongText(99999)};
+
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize(800, 600);
+    gui.add(textBox);
+
+    std::size_t index = 0;
+    while (state.keepRunning())
+    {
+        textBox->setText(texts[index]);
+        index = 1 - index;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/TextBox/draw100k")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize(800, 600);
+    textBox->setText(createLongText(100000));
+    gui.add(textBox);
+
+    while (state.keepRunning())
+        bench::drawGui(gui);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/ChatBox/addLine")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->setSize(400, 300);
+    chatBox->setLineLimit(1000);
+    gui.add(chatBox);
+
+    // Once the limit is reached, every added line also removes the oldest one
+    const sf::String line = createLongText(80);
+    while (state.keepRunning())
+        chatBox->addLine(line);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/ListBox/addItem")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto listBox = tgui::ListBox::create();
+    listBox->setSize(400, 300);
+    gui.add(listBox);
+
+    std::size_t count = 0;
+    while (state.keepRunning())
+    {
+        listBox->addItem("Item");
+
+        // Don't let the list grow without bounds when there are many iterations
+        if (++count == 10000)
+        {
+            state.pauseTiming();
+            listBox->removeAllItems();
+            count = 0;
+            state.resumeTiming();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Text/EditBox/typeFloat")
+{
+    tgui::Gui gui{bench::getRenderTexture()};
+    gui.setFont(bench::getFont());
+    auto editBox = tgui::EditBox::create();
+    editBox->setInputValidator(tgui::EditBox::Validator::Float);
+    gui.add(editBox);
+
+    // Type digits at the end of the text, the validator has to accept the new text every time
+    std::size_t count = 0;
+    while (state.keepRunning())
+    {
+        editBox->textEntered(static_cast<sf::Uint32>('0' + (count % 10)));
+
+        if (++count == 1000)
+        {
+            state.pauseTiming();
+            editBox->setText("");
+            count = 0;
+            state.resumeTiming();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
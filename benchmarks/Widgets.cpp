@@ -0,0 +1,269 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Creating, copying, drawing and moving the mouse over every widget type
+
+#include "Benchmark.hpp"
+
+#include <TGUI/Widgets/devel/DataGrid.hpp>
+#include <TGUI/Widgets/devel/RichTextLabel.hpp>
+#include <TGUI/Widgets/devel/Table.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    struct WidgetType
+    {
+        std::string name;
+        std::function<tgui::Widget::Ptr()> create;
+    };
+
+    // Every widget gets some contents, so that drawing it does more than drawing an empty background
+    std::vector<WidgetType> getWidgetTypes()
+    {
+        return {
+            {"Button", []{ return tgui::Button::create("Button"); }},
+            {"Canvas", []{ return tgui::Canvas::create({200, 100}); }},
+            {"ChatBox", []{
+                auto chatBox = tgui::ChatBox::create();
+                for (unsigned int i = 0; i < 20; ++i)
+                    chatBox->addLine("Line " + tgui::to_string(i));
+                return chatBox;
+            }},
+            {"CheckBox", []{ return tgui::CheckBox::create("CheckBox"); }},
+            {"ChildWindow", []{
+                auto window = tgui::ChildWindow::create();
+                window->setTitle("Window");
+                window->add(tgui::Button::create("Button"));
+                return window;
+            }},
+            {"ClickableWidget", []{ return tgui::ClickableWidget::create({200, 100}); }},
+            {"ComboBox", []{
+                auto comboBox = tgui::ComboBox::create();
+                for (unsigned int i = 0; i < 20; ++i)
+                    comboBox->addItem("Item " + tgui::to_string(i));
+                comboBox->setSelectedItemByIndex(0);
+                return comboBox;
+            }},
+            {"EditBox", []{
+                auto editBox = tgui::EditBox::create();
+                editBox->setText("Some text");
+                return editBox;
+            }},
+            {"Grid", []{
+                auto grid = tgui::Grid::create();
+                for (unsigned int row = 0; row < 3; ++row)
+                {
+                    for (unsigned int column = 0; column < 3; ++column)
+                        grid->addWidget(tgui::Button::create("Button"), row, column);
+                }
+                return grid;
+            }},
+            {"Knob", []{ return tgui::Knob::create(); }},
+            {"Label", []{ return tgui::Label::create("Label"); }},
+            {"ListBox", []{
+                auto listBox = tgui::ListBox::create();
+                for (unsigned int i = 0; i < 20; ++i)
+                    listBox->addItem("Item " + tgui::to_string(i));
+                return listBox;
+            }},
+            {"MenuBar", []{
+                auto menuBar = tgui::MenuBar::create();
+                menuBar->addMenu("File");
+                menuBar->addMenuItem("Load");
+                menuBar->addMenuItem("Save");
+                menuBar->addMenu("Edit");
+                menuBar->addMenuItem("Copy");
+                return menuBar;
+            }},
+            {"MessageBox", []{
+                auto messageBox = tgui::MessageBox::create();
+                messageBox->setText("Message");
+                messageBox->addButton("Ok");
+                messageBox->addButton("Cancel");
+                return messageBox;
+            }},
+            {"Panel", []{
+                auto panel = tgui::Panel::create({200, 100});
+                panel->add(tgui::Button::create("Button"));
+                return panel;
+            }},
+            {"Picture", []{ return tgui::Picture::create("widgets/Black.png"); }},
+            {"ProgressBar", []{
+                auto progressBar = tgui::ProgressBar::create();
+                progressBar->setValue(50);
+                progressBar->setText("50%");
+                return progressBar;
+            }},
+            {"RadioButton", []{
+                auto radioButton = tgui::RadioButton::create();
+                radioButton->setText("RadioButton");
+                return radioButton;
+            }},
+            {"ScrollablePanel", []{
+                auto panel = tgui::ScrollablePanel::create({200, 100});
+                for (unsigned int i = 0; i < 100; ++i)
+                {
+                    auto button = tgui::Button::create("Button " + tgui::to_string(i));
+                    button->setPosition(0, i * 30.f);
+                    panel->add(button);
+                }
+                panel->setScrollOffset(1500);
+                return panel;
+            }},
+            {"Scrollbar", []{
+                auto scrollbar = tgui::Scrollbar::create();
+                scrollbar->setMaximum(100);
+                scrollbar->setLowValue(20);
+                return scrollbar;
+            }},
+            {"Slider", []{ return tgui::Slider::create(0, 100); }},
+            {"SpinButton", []{ return tgui::SpinButton::create(0, 100); }},
+            {"Tab", []{
+                auto tab = tgui::Tab::create();
+                tab->add("First");
+                tab->add("Second");
+                tab->add("Third");
+                return tab;
+            }},
+            {"TextBox", []{
+                auto textBox = tgui::TextBox::create();
+                textBox->setText("Some text\nOn multiple\nlines");
+                return textBox;
+            }},
+            {"ThreadedCanvas", []{
+                // The render thread isn't started, so only the widget itself and its buffers are measured
+                auto canvas = tgui::ThreadedCanvas::create({200, 100});
+                canvas->setRenderFunction([](sf::RenderTarget& target){ target.clear(sf::Color::Green); });
+                return canvas;
+            }},
+            {"DataGrid", []{
+                auto grid = tgui::DataGrid::create();
+                grid->setHeaderColumns({"Name", "Value"});
+                for (unsigned int i = 0; i < 100; ++i)
+                    grid->addRow({"Row " + tgui::to_string(i), tgui::to_string(i)});
+                return grid;
+            }},
+            {"RichTextLabel", []{
+                auto label = std::make_shared<tgui::RichTextLabel>();
+                label->setText(L"*bold*, ~italic~, _underlined_ and normal text");
+                return label;
+            }},
+            {"Table", []{
+                auto table = std::make_shared<tgui::Table>();
+                table->setHeaderColumns({"Name", "Value"});
+                for (unsigned int i = 0; i < 10; ++i)
+                    table->addRow({"Row " + tgui::to_string(i), tgui::to_string(i)});
+                return table;
+            }}
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Event makeMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_GROUP()
+{
+    for (const auto& type : getWidgetTypes())
+    {
+        const auto create = type.create;
+
+        bench::addBenchmark("Widget/" + type.name + "/create", [create](bench::State& state)
+        {
+            while (state.keepRunning())
+                bench::doNotOptimize(create());
+        });
+
+        bench::addBenchmark("Widget/" + type.name + "/copy", [create](bench::State& state)
+        {
+            const auto widget = create();
+            while (state.keepRunning())
+                bench::doNotOptimize(widget->clone());
+        });
+
+        bench::addBenchmark("Widget/" + type.name + "/draw", [create](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            gui.setFont(bench::getFont());
+            auto widget = create();
+            widget->setPosition(50, 50);
+            widget->setSize(200, 100);
+            gui.add(widget);
+
+            while (state.keepRunning())
+                bench::drawGui(gui);
+        });
+
+        bench::addBenchmark("Widget/" + type.name + "/mouseMoved", [create](bench::State& state)
+        {
+            tgui::Gui gui{bench::getRenderTexture()};
+            gui.setFont(bench::getFont());
+            auto widget = create();
+            widget->setPosition(50, 50);
+            widget->setSize(200, 100);
+            gui.add(widget);
+
+            // Alternate between a position on top of the widget and one next to it, so that the hover state changes
+            const sf::Event eventOnWidget = makeMouseMoveEvent(100, 80);
+            const sf::Event eventNextToWidget = makeMouseMoveEvent(400, 400);
+            bool onWidget = false;
+            while (state.keepRunning())
+            {
+                onWidget = !onWidget;
+                gui.handleEvent(onWidget ? eventOnWidget : eventNextToWidget);
+            }
+        });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Texture/draw")
+{
+    tgui::Texture texture{"widgets/Black.png", {0, 64, 45, 50}, {10, 0, 25, 50}};
+    texture.setPosition(10, 10);
+    texture.setSize({200, 100});
+
+    sf::RenderTexture& target = bench::getRenderTexture();
+    while (state.keepRunning())
+    {
+        target.clear();
+        target.draw(texture);
+        target.display();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
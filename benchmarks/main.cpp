@@ -0,0 +1,271 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Runs the benchmarks and writes the results as json.
+//
+// Usage: benchmarks [--filter text] [--output file.json] [--min-time seconds]
+//
+// The benchmarks draw to an sf::RenderTexture, so no window is opened. To run them on a machine without a gpu,
+// use a software OpenGL implementation (e.g. LIBGL_ALWAYS_SOFTWARE=1 with Mesa, inside xvfb-run when there is no display).
+//
+// Allocations are counted by replacing the global operator new. This also counts allocations made inside the TGUI
+// and SFML libraries on platforms where the operator is resolved at load time (e.g. Linux), but not in DLLs on Windows.
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+    std::atomic<std::size_t> allocatedBytes{0};
+
+    struct Result
+    {
+        std::string name;
+        std::size_t iterations;
+        double nsPerOp;
+        double allocsPerOp;
+        double bytesPerOp;
+    };
+
+    std::string escapeJson(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+                result += '\\';
+
+            result += c;
+        }
+
+        return result;
+    }
+
+    void writeJson(std::ostream& stream, const std::vector<Result>& results)
+    {
+        stream << "{\n"
+               << "  \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n"
+               << "  \"benchmarks\": [\n";
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            stream << "    {\"name\": \"" << escapeJson(results[i].name) << "\""
+                   << ", \"iterations\": " << results[i].iterations
+                   << std::fixed << std::setprecision(2)
+                   << ", \"ns_per_op\": " << results[i].nsPerOp
+                   << ", \"allocs_per_op\": " << results[i].allocsPerOp
+                   << ", \"bytes_per_op\": " << results[i].bytesPerOp
+                   << "}" << ((i + 1 < results.size()) ? ",\n" : "\n");
+        }
+
+        stream << "  ]\n"
+               << "}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(size ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    std::size_t getAllocationCount()
+    {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t getAllocatedBytes()
+    {
+        return allocatedBytes.load(std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Benchmark>& getBenchmarks()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::RenderTexture& getRenderTexture()
+    {
+        static sf::RenderTexture texture;
+        if (texture.getSize().x == 0)
+        {
+            if (!texture.create(1024, 768))
+            {
+                std::cerr << "Failed to create the render texture, an OpenGL context is required" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> getFont()
+    {
+        static std::shared_ptr<sf::Font> font;
+        if (!font)
+        {
+            font = std::make_shared<sf::Font>();
+            if (!font->loadFromFile("fonts/DejaVuSans.ttf"))
+            {
+                std::cerr << "Failed to load fonts/DejaVuSans.ttf" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void drawGui(tgui::Gui& gui)
+    {
+        sf::RenderTexture& texture = getRenderTexture();
+        texture.clear();
+        gui.draw();
+        texture.display();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::string outputFile;
+    double minTime = 0.2;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if ((arg == "--filter") && (i + 1 < argc))
+            filter = argv[++i];
+        else if ((arg == "--output") && (i + 1 < argc))
+            outputFile = argv[++i];
+        else if ((arg == "--min-time") && (i + 1 < argc))
+            minTime = std::atof(argv[++i]);
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--filter text] [--output file.json] [--min-time seconds]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Create the render texture and load the font before measuring anything
+    bench::getRenderTexture();
+    bench::getFont();
+
+    std::vector<Result> results;
+    for (const auto& benchmark : bench::getBenchmarks())
+    {
+        if (!filter.empty() && (benchmark.name.find(filter) == std::string::npos))
+            continue;
+
+        // Keep increasing the amount of iterations until the measurement takes long enough to be reliable
+        std::size_t iterations = 1;
+        while (true)
+        {
+            bench::State state{iterations};
+            benchmark.function(state);
+
+            const double elapsedNs = std::chrono::duration<double, std::nano>(state.getElapsedTime()).count();
+            if ((elapsedNs >= minTime * 1e9) || (iterations >= 1000000000))
+            {
+                results.push_back({benchmark.name,
+                                   iterations,
+                                   elapsedNs / iterations,
+                                   static_cast<double>(state.getAllocations()) / iterations,
+                                   static_cast<double>(state.getAllocatedBytes()) / iterations});
+
+                std::cerr << std::left << std::setw(60) << benchmark.name << std::right
+                          << std::setw(14) << std::fixed << std::setprecision(1) << results.back().nsPerOp << " ns/op"
+                          << std::setw(12) << std::setprecision(1) << results.back().allocsPerOp << " allocs/op" << std::endl;
+                break;
+            }
+
+            const double factor = (elapsedNs > 0) ? (minTime * 1e9 / elapsedNs) * 1.2 : 100;
+            iterations = std::max(iterations + 1, std::min(iterations * 100, static_cast<std::size_t>(iterations * factor)));
+        }
+    }
+
+    if (outputFile.empty())
+        writeJson(std::cout, results);
+    else
+    {
+        std::ofstream file{outputFile};
+        if (!file)
+        {
+            std::cerr << "Failed to open " << outputFile << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        writeJson(file, results);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -27,6 +27,7 @@
 #define TGUI_CLIPPING_HPP
 
 #include <TGUI/Global.hpp>
+#include <TGUI/Profiler.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/OpenGL.hpp>
@@ -71,6 +72,7 @@ namespace tgui
 
             // Set the clipping area
             glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+            TGUI_PROFILE_SCISSOR_CHANGE();
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +87,7 @@ namespace tgui
         ~Clipping()
         {
             glScissor(m_scissor[0], m_scissor[1], m_scissor[2], m_scissor[3]);
+            TGUI_PROFILE_SCISSOR_CHANGE();
         };
 
 
@@ -277,6 +277,42 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn to a cached texture
+        ///
+        /// @param enabled  Should the child widgets be rendered once and reused until something changes?
+        ///
+        /// When the render cache is enabled, the child widgets are drawn to a render texture which is only redrawn after one
+        /// of the widgets was invalidated. This makes drawing a container with mostly static contents a lot cheaper.
+        /// The cache is rendered at the size of the container, so the contents might look blurry when the view is scaled.
+        ///
+        /// The render cache is disabled by default.
+        ///
+        /// @see Widget::invalidate
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to a cached texture
+        ///
+        /// @return Is the render cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const
+        {
+            return m_renderCacheEnabled;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the container that its visual appearance or the appearance of one of its child widgets has changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Load the child widgets from a text file
         ///
@@ -291,6 +327,11 @@ namespace tgui
         ///
         /// @param filename  Filename of the widget file
         ///
+        /// The widgets are first written to a temporary file (filename + ".tmp") which only replaces the existing file when
+        /// everything was saved successfully.
+        ///
+        /// @throw Exception when the file couldn't be written or when a widget couldn't be saved
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void saveWidgetsToFile(const std::string& filename);
 
@@ -395,6 +436,12 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the container or one of its child widgets has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -424,12 +471,46 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(float x, float y);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the translation of the child widgets that is applied on top of their position when drawing them and when
+        // passing mouse events to them. Containers that scroll their contents return the negative scroll offset here,
+        // so that scrolling doesn't require changing the position of all child widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getContentOffset() const
+        {
+            return sf::Vector2f{0, 0};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether a child widget lies (partially) inside the visible area of the container.
+        // Widgets for which this returns false are neither drawn nor considered when looking for the widget below the mouse.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isChildWidgetInView(const Widget&) const
+        {
+            return true;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all child widgets to the render cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRenderCache(sf::RenderTarget* target) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when a child widget was invalidated.
+        // The area is relative to the position of the child widgets and is passed on to the parent in its own coordinates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childInvalidated(const sf::FloatRect& area);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -444,6 +525,14 @@ namespace tgui
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // The child widgets can be drawn to a texture which is only updated when one of them changes
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheValid = false;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+
+        // The child widgets that have running animations or timers, only these widgets are updated every frame
+        std::vector<Widget::Ptr> m_scheduledWidgets;
+
 
         friend class Widget;
 
@@ -488,6 +577,22 @@ namespace tgui
         virtual bool mouseOnWidget(float x, float y) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the entire window as dirty
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the area of the invalidated child widget to the dirty area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childInvalidated(const sf::FloatRect& area) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -511,6 +616,10 @@ namespace tgui
 
         sf::RenderTarget* m_window = nullptr;
 
+        // Has anything changed since the last time the gui was drawn and which part of the window has changed?
+        bool m_redrawNeeded = true;
+        sf::FloatRect m_dirtyArea;
+
 
         friend class Gui;
 
@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DISTANCE_FIELD_FONT_HPP
+#define TGUI_DISTANCE_FIELD_FONT_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Glyph atlas that stores signed distance fields instead of coverage bitmaps
+    ///
+    /// Every glyph is rasterized only once, at the reference size. The distance field is drawn with a shader that finds
+    /// the edge of the glyph again, so the same atlas gives sharp text at every character size and when the view is scaled.
+    ///
+    /// All metrics are given for a character size of 1, they have to be multiplied with the character size.
+    ///
+    /// Distance fields are used for a font after calling enable (or Font::enableDistanceField).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DistanceFieldFont
+    {
+    public:
+
+        struct Glyph
+        {
+            float advance = 0;         ///< Horizontal offset to the next character
+            sf::FloatRect bounds;      ///< Bounds of the quad relative to the baseline, including the spread around the glyph
+            sf::FloatRect textureRect; ///< Pixels of the glyph in the atlas texture
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates an empty atlas for the font
+        ///
+        /// @param font           Font from which the glyphs are rasterized
+        /// @param referenceSize  Character size at which the glyphs are rasterized
+        /// @param spread         Distance in pixels (at the reference size) around the edges that is stored in the field
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DistanceFieldFont(std::shared_ptr<sf::Font> font, unsigned int referenceSize = 48, unsigned int spread = 6);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a glyph, which is added to the atlas when it wasn't used before
+        ///
+        /// @param codePoint  Unicode code point of the character
+        /// @param bold       Should the bold version of the glyph be returned?
+        ///
+        /// The returned reference stays valid as long as the font exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Glyph& getGlyph(sf::Uint32 codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all glyphs of a text to the atlas at once
+        ///
+        /// @param text  Characters to add
+        /// @param bold  Should the bold versions of the glyphs be added?
+        ///
+        /// This is faster than adding the glyphs one by one, as the texture of the font only has to be copied once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadGlyphs(const sf::String& text, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset between two characters, for a character size of 1
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line spacing, for a character size of 1
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the atlas texture, which has to be drawn with the shader returned by getShader
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture() const
+        {
+            return m_texture;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the atlas that is completely inside the glyphs, used to draw underlines
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getSolidRect() const
+        {
+            return {1, 1, 2, 2};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size at which the glyphs are rasterized
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getReferenceSize() const
+        {
+            return m_referenceSize;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance in pixels (at the reference size) around the edges that is stored in the field
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getSpread() const
+        {
+            return m_spread;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font from which the glyphs are rasterized
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<sf::Font>& getFont() const
+        {
+            return m_font;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the shader that draws the distance fields
+        ///
+        /// @return Shader, or nullptr when shaders aren't supported or the shader could not be compiled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::Shader* getShader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws text with distance fields instead of the normal glyphs of the font
+        ///
+        /// @param font           The font
+        /// @param referenceSize  Character size at which the glyphs are rasterized
+        ///
+        /// @return The atlas of the font
+        ///
+        /// The font is kept alive until disable is called. Text layouts that were already cached are removed from the cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<DistanceFieldFont> enable(const std::shared_ptr<sf::Font>& font, unsigned int referenceSize = 48);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws text with the normal glyphs of the font again
+        ///
+        /// @param font  The font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void disable(const sf::Font* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the atlas of a font for which distance fields were enabled
+        ///
+        /// @param font  The font
+        ///
+        /// @return Atlas of the font, or nullptr when distance fields aren't enabled for the font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<DistanceFieldFont> get(const sf::Font* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Calculates the distance field of a glyph that was rasterized in the font image and copies it into the atlas
+        void addGlyph(sf::Uint32 codePoint, bool bold, const sf::Image& fontImage);
+
+        // Finds a free place in the atlas for a glyph of the given size, the atlas is made higher when it is full
+        sf::Vector2u allocate(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::shared_ptr<sf::Font> m_font;
+        unsigned int m_referenceSize;
+        unsigned int m_spread;
+
+        // Glyphs are stored with the bold flag in the upper bits of the key
+        std::map<sf::Uint64, Glyph> m_glyphs;
+
+        sf::Image m_atlas;
+        sf::Texture m_texture;
+        unsigned int m_nextX = 0;
+        unsigned int m_nextY = 0;
+        unsigned int m_rowHeight = 0;
+
+        static std::map<const sf::Font*, std::shared_ptr<DistanceFieldFont>> m_enabledFonts;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_FONT_HPP
@@ -97,6 +97,37 @@ namespace tgui
         std::shared_ptr<sf::Font> getFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws text in this font with a signed distance field atlas instead of a glyph texture per character size
+        ///
+        /// @param referenceSize  Character size at which every glyph is rasterized once
+        ///
+        /// The text then stays sharp at every size and when the gui is scaled with Gui::setView, without rasterizing the glyphs
+        /// again. Text is only drawn with distance fields when shaders are supported. Call this function before the text of
+        /// the widgets is set, text that was already laid out keeps using the normal glyphs.
+        ///
+        /// @see DistanceFieldFont
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void enableDistanceField(unsigned int referenceSize = 48) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws text in this font with the normal glyphs again
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disableDistanceField() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether text in this font is drawn with a signed distance field atlas
+        ///
+        /// @return Was enableDistanceField called?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceFieldEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
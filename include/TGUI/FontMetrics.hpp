@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FONT_METRICS_HPP
+#define TGUI_FONT_METRICS_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Table of the line spacing and vertical text correction of a font for every character size
+    ///
+    /// Asking sfml for the line spacing changes the size of the font face and the vertical correction even requires a glyph,
+    /// so every value is only calculated the first time it is needed. Widgets that choose their text size based on their
+    /// height can then be resized without querying the font again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontMetrics
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates an empty table for the font
+        ///
+        /// @param font  Font of which the metrics are stored, which has to outlive the table
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit FontMetrics(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line spacing of the font
+        ///
+        /// @param characterSize  Text size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the offset that text has to be moved up, see getTextVerticalCorrection
+        ///
+        /// @param characterSize  Text size
+        /// @param bold           Is the text bold?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getVerticalCorrection(unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the best character size for the text, see findBestTextSize
+        ///
+        /// @param height  Height that the text should fill
+        /// @param fit     0 to choose best fit, 1 to select font of at least that height, -1 to select font of maximum that height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int findBestTextSize(float height, int fit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the table of a font, which is created when the font is used for the first time
+        ///
+        /// @param font  The font
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FontMetrics& get(const std::shared_ptr<sf::Font>& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the tables of all fonts, e.g. after a font was loaded again from a different file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Character sizes above this size are not stored in the tables
+        static const unsigned int maxCachedSize = 1024;
+
+        const sf::Font* m_font;
+
+        // The value for a character size is stored at index characterSize - 1, negative values haven't been calculated yet
+        std::vector<float> m_lineSpacing;
+        std::vector<float> m_verticalCorrection[2];
+
+        struct Entry
+        {
+            std::weak_ptr<sf::Font> font;
+            std::unique_ptr<FontMetrics> metrics;
+        };
+
+        static std::map<const sf::Font*, Entry> m_fontMetrics;
+        static Entry* m_lastUsedEntry;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_METRICS_HPP
@@ -38,6 +38,7 @@
 #include <sstream>
 #include <memory>
 #include <locale>
+#include <type_traits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,8 +56,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Maximum amount of characters that the formatNumber functions write to the buffer
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const std::size_t maxFormattedNumberLength = 64;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Writes a number to the buffer and returns the amount of characters that were written. The global locale is ignored.
+    // Floating point numbers are written with the least amount of digits needed to read back exactly the same value.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API std::size_t formatNumber(char* buffer, long long value);
+    TGUI_API std::size_t formatNumber(char* buffer, unsigned long long value);
+    TGUI_API std::size_t formatNumber(char* buffer, float value);
+    TGUI_API std::size_t formatNumber(char* buffer, double value);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Reads the number at the start of the characters between begin and end. The global locale is ignored.
+    // Whitespace in front of the number is skipped and characters behind the number are ignored.
+    // Returns false when no number could be read or when it doesn't fit in the type.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool parseNumber(const char* begin, const char* end, int& value);
+    TGUI_API bool parseNumber(const char* begin, const char* end, float& value);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        // Numbers that are formatted with formatNumber instead of with a string stream (characters and bools are excluded
+        // because a stream doesn't print them as numbers)
+        template <typename T>
+        struct isFormattableNumber
+        {
+            static const bool value = (std::is_integral<T>::value || std::is_floating_point<T>::value)
+                                   && !std::is_same<T, bool>::value && !std::is_same<T, char>::value
+                                   && !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value
+                                   && !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value
+                                   && !std::is_same<T, char32_t>::value;
+        };
+
+        template <typename T>
+        struct formattedNumberType
+        {
+            using type = typename std::conditional<std::is_floating_point<T>::value,
+                             typename std::conditional<std::is_same<T, float>::value, float, double>::type,
+                             typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type>::type;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    typename std::enable_if<priv::isFormattableNumber<T>::value, std::string>::type to_string(T value)
+    {
+        char buffer[maxFormattedNumberLength];
+        return std::string(buffer, formatNumber(buffer, static_cast<typename priv::formattedNumberType<T>::type>(value)));
+    }
+
     template <typename T>
-    std::string to_string(T value)
+    typename std::enable_if<!priv::isFormattableNumber<T>::value, std::string>::type to_string(T value)
     {
         std::ostringstream oss;
         oss.imbue(std::locale::classic());
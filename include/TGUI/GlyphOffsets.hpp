@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_GLYPH_OFFSETS_HPP
+#define TGUI_GLYPH_OFFSETS_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Horizontal positions of the characters in a line of text, used to map between caret positions and coordinates
+    ///
+    /// The offsets are the running sum of the glyph advances and kerning, which are calculated once when the text changes.
+    /// Finding the caret position below the mouse is then a binary search instead of walking over the glyphs again on every
+    /// mouse move.
+    ///
+    /// The offset of a character is the same as what sf::Text::findCharacterPos returns for it, so it doesn't include the
+    /// kerning with the character in front of it. There is one extra offset behind the last character, which is the width of
+    /// the line.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphOffsets
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor, which creates the offsets of an empty line
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphOffsets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the offsets of all characters in a line
+        ///
+        /// @param text           Line of text
+        /// @param font           Font used to draw the text
+        /// @param characterSize  Text size
+        /// @param bold           Is the text bold?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const sf::String& text, const sf::Font& font, unsigned int characterSize, bool bold = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the offsets after the text was changed starting from a given character
+        ///
+        /// @param text                   The line of text after it was changed
+        /// @param firstChangedCharacter  Index of the first character that was inserted, removed or replaced
+        /// @param font                   Font used to draw the text
+        /// @param characterSize          Text size
+        /// @param bold                   Is the text bold?
+        ///
+        /// The characters in front of the changed one keep their offsets, so typing at the end of a line only has to
+        /// calculate the offset of the new character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(const sf::String& text, std::size_t firstChangedCharacter, const sf::Font& font, unsigned int characterSize, bool bold = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the offsets of the characters starting from the given index
+        ///
+        /// @param characterCount  Amount of characters of which the offsets are kept
+        ///
+        /// Together with addCharacter, this allows widgets that already walk over the glyphs to fill in the offsets themselves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void truncate(std::size_t characterCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a character at the end of the line
+        ///
+        /// @param offsetBehindCharacter  Offset of the position behind the added character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addCharacter(float offsetBehindCharacter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters of which the offsets are stored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCharacterCount() const
+        {
+            return m_offsets.size() - 1;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance between the start of the line and a character
+        ///
+        /// @param index  Index of the character, or the amount of characters to get the position behind the last character
+        ///
+        /// @return Offset of the character, or the width of the line when the index is too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getOffset(std::size_t index) const
+        {
+            return (index < m_offsets.size()) ? m_offsets[index] : m_offsets.back();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of the line
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getWidth() const
+        {
+            return m_offsets.back();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the caret position that is the closest to a horizontal position
+        ///
+        /// @param x  Distance from the start of the line
+        ///
+        /// @return Index of the character in front of which the caret belongs, between 0 and the amount of characters
+        ///
+        /// The caret is placed in front of a character when the position lies on the left half of it and behind the character
+        /// when it lies on the right half.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findCaretPosition(float x) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<float> m_offsets;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_OFFSETS_HPP
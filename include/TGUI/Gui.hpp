@@ -30,6 +30,7 @@
 #include <queue>
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Tween.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -158,6 +159,39 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether anything has changed since the last time the gui was drawn.
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// This function updates the internal clock, so that running animations and blinking carets are taken into account.
+        /// When it returns false, the previous frame can be displayed again without calling draw.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the gui that changed since the last time the gui was drawn.
+        ///
+        /// @return Union of the areas of all changed widgets, in the coordinates of the view of the gui.
+        ///         The rectangle is empty when nothing has to be redrawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getDirtyArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only redraws the part of the gui that changed since the last time the gui was drawn.
+        ///
+        /// Everything is clipped to the area returned by getDirtyArea. This function can only be used when the render target
+        /// still contains the previous frame (e.g. when drawing the gui to a sf::RenderTexture that isn't cleared between frames).
+        /// The part of the target behind the dirty area has to be restored before calling this function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawDirtyArea();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the container.
         ///
@@ -186,6 +220,20 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tweener that is updated by the gui every frame
+        ///
+        /// Tweens added to this tweener are played while the gui is being drawn.
+        ///
+        /// @return Reference to the tweener of the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tweener& getTweener()
+        {
+            return m_tweener;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the global font.
         ///
@@ -455,6 +503,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the gui, optionally clipped to the dirty area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawImpl(bool onlyDirtyArea);
+
+
         // The internal clock which is used for animation of widgets
         sf::Clock m_clock;
 
@@ -467,6 +521,9 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
 
+        // Plays the tweens of all widgets in the gui
+        Tweener m_tweener;
+
         Widget::Ptr m_visibleToolTip = nullptr;
         sf::Time m_tooltipTime;
         bool m_tooltipPossible = false;
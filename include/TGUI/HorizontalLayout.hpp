@@ -85,7 +85,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<HorizontalLayout>(*this);
+            return makePooled<HorizontalLayout>(*this);
         }
 
 
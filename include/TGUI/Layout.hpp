@@ -28,6 +28,7 @@
 
 #include <SFML/System/Vector2.hpp>
 #include <TGUI/Config.hpp>
+#include <TGUI/MemoryPool.hpp>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -96,8 +97,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
         float value = 0; ///< Cached value of the layout
-        std::set<Layout*> attachedLayouts; ///< Layout objects that use this shared object
-        std::set<LayoutImpl*> parents; ///< Other layouts that make use of this layout in their expression
+        std::set<Layout*, std::less<Layout*>, PoolAllocator<Layout*>> attachedLayouts; ///< Layout objects that use this shared object
+        std::set<LayoutImpl*, std::less<LayoutImpl*>, PoolAllocator<LayoutImpl*>> parents; ///< Other layouts that make use of this layout in their expression
 
         Operation operation = Operation::Value; ///< Does the layout contain a value or an operation between other layouts?
         std::vector<std::shared_ptr<LayoutImpl>> operands; ///< Operands used in the operation that this object performs
@@ -248,7 +249,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        std::shared_ptr<LayoutImpl> m_impl = std::make_shared<LayoutImpl>();
+        std::shared_ptr<LayoutImpl> m_impl = makePooled<LayoutImpl>();
         std::function<void()> m_callbackFunction;
     };
 
@@ -0,0 +1,167 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_ASYNC_LOADER_HPP
+#define TGUI_ASYNC_LOADER_HPP
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Texture.hpp>
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Reads and parses theme and widget files and decodes their images on background threads
+    ///
+    /// Only the work that doesn't touch widgets or OpenGL is done by the worker threads. The widgets themselves still have to
+    /// be created on the gui thread, but by then the files were already parsed and the images were already decoded:
+    /// @code
+    /// tgui::AsyncLoader loader;
+    /// auto themeLoaded = loader.preloadTheme("widgets/Black.txt");
+    /// auto screenParsed = loader.parseWidgetFile("screens/MainMenu.txt");
+    ///
+    /// // Later, on the gui thread (e.g. once screenParsed.wait_for(std::chrono::seconds(0)) returns ready)
+    /// auto theme = tgui::Theme::create("widgets/Black.txt");
+    /// tgui::WidgetLoader::load(gui.getContainer(), screenParsed.get());
+    /// @endcode
+    ///
+    /// Exceptions that are thrown while loading a file (e.g. because it doesn't exist) are rethrown by the get function
+    /// of the returned future.
+    ///
+    /// The resource path and the image cache directory of the texture manager are read when a file is requested.
+    /// Files are read directly from the disk, even on Android.
+    /// When a custom image loader is set with Texture::setImageLoader, then it will be called from the worker threads.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API AsyncLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts the worker threads
+        ///
+        /// @param threadCount  Amount of worker threads, or 0 to use one thread per hardware thread
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit AsyncLoader(unsigned int threadCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes the files that were already requested and stops the worker threads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~AsyncLoader();
+
+
+        AsyncLoader(const AsyncLoader&) = delete;
+        AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a theme file into the cache of the DefaultThemeLoader and decodes all images used in it
+        ///
+        /// @param filename  Filename of the theme file, relative to the resource path
+        ///
+        /// @return Future that becomes ready once the theme and its images are loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<void> preloadTheme(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads and parses a widget file and decodes the images used by its renderers
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /// @return Future containing the parsed file, which can be passed to WidgetLoader::load
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<std::shared_ptr<DataIO::Node>> parseWidgetFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes an image so that the texture manager doesn't have to load it later
+        ///
+        /// @param filename  Filename of the image, relative to the resource path
+        ///
+        /// @return Future that becomes ready once the image is decoded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<void> preloadImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of worker threads
+        ///
+        /// @return Thread count
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getThreadCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds a function to the queue, which will be executed by the first worker thread that is free
+        void addTask(std::function<void()> task);
+
+        // Loop executed by the worker threads
+        void runWorker();
+
+        // Loads the image through the disk cache and stores it in the texture manager, unless it is already stored.
+        // When another worker is already decoding the image then this function waits until it is done.
+        void decodeImage(const std::string& filename, const Texture::ImageLoaderFunc& imageLoader, const std::string& cacheDirectory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_taskAdded;
+        bool m_stopping = false;
+
+        // Images that are currently being decoded by one of the worker threads, with a future that is ready once the
+        // image was stored in the texture manager (protected by m_mutex)
+        std::map<std::string, std::shared_future<void>> m_imagesBeingDecoded;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ASYNC_LOADER_HPP
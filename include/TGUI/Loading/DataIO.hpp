@@ -90,17 +90,20 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emit the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
+        /// @param rootNode Root node of the tree of nodes that is to be written to the stream
         /// @param stream   Stream to which the widget file will be added
         ///
+        /// The text is collected in a buffer which is written to the stream in large blocks.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(std::shared_ptr<Node> rootNode, std::stringstream& stream);
+        static void emit(std::shared_ptr<Node> rootNode, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::string> convertNodesToLines(std::shared_ptr<Node> node);
+        static void emitNode(const Node& node, std::size_t depth, std::string& buffer, std::ostream& stream);
+
+        static void flushBuffer(std::string& buffer, std::ostream& stream, bool force);
 
         static std::string parseSection(std::stringstream& stream, std::shared_ptr<Node> node, const std::string& sectionName);
 
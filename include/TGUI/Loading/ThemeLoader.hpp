@@ -29,7 +29,9 @@
 
 #include <TGUI/Widget.hpp>
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -78,6 +80,7 @@ namespace tgui
     /// This loader will be able to extract the data from these files.
     ///
     /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// The cache is shared between all loaders and may be filled from multiple threads.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
@@ -100,6 +103,19 @@ namespace tgui
         virtual std::string load(const std::string& filename, const std::string& className, PropertyValuePairs& properties);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads and parses the theme file and stores its contents in the cache, unless it was already cached
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// This function may be called from any thread, e.g. to parse the theme files in the background.
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empty the caches and force files to be reloaded.
         ///
@@ -123,10 +139,24 @@ namespace tgui
         virtual void readFile(const std::string& filename, std::stringstream& contents) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the values of properties in a cached theme file
+        ///
+        /// @param filename        Filename of the theme file
+        /// @param propertyFilter  Function that is passed the lowercase name of each property and returns whether to include it
+        ///
+        /// This function may be called from any thread. An empty list is returned when the file isn't in the cache.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<std::string> getCachedPropertyValues(const std::string& filename,
+                                                                const std::function<bool(const std::string&)>& propertyFilter);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, std::map<std::string, PropertyValuePairs>> m_propertiesCache;
         static std::map<std::string, std::map<std::string, std::string>> m_widgetTypeCache;
+        static std::mutex m_cacheMutex;
 
         friend struct DefaultThemeLoaderTest;
     };
@@ -58,6 +58,18 @@ namespace tgui
         static void load(Container::Ptr parent, std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Load a container and its child widgets from a widget file that was already parsed
+        ///
+        /// @param parent    The parent container for the child widget
+        /// @param rootNode  Root node returned by DataIO::parse for the widget file
+        ///
+        /// This allows the file to be read and parsed on a different thread, see AsyncLoader.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void load(Container::Ptr parent, std::shared_ptr<DataIO::Node> rootNode);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Change the load function for a certain widget type
         ///
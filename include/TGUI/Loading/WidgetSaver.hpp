@@ -51,11 +51,15 @@ namespace tgui
         /// @param widget  The container to save
         /// @param stream  Stream to which the widget file will be written to
         ///
+        /// The save functions still build a tree of DataIO nodes for each child widget, but every top-level child is
+        /// written to the stream and released before the next one is saved. So only the nodes of a single top-level
+        /// widget are kept in memory, instead of a copy of the entire widget file.
+        ///
         /// @note You should use the saveWidgetsToFile or saveWidgetsToSteam functions in Gui and Container
         ///       instead of calling this function directly.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void save(Container::Ptr widget, std::stringstream& stream);
+        static void save(Container::Ptr widget, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
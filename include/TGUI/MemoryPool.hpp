@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MEMORY_POOL_HPP
+#define TGUI_MEMORY_POOL_HPP
+
+#include <TGUI/Config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Pool from which widgets, renderers, signals and layouts are allocated
+    ///
+    /// Small objects are grouped by size and allocated from big chunks of memory, so that creating a screen with thousands
+    /// of widgets only needs a few allocations from the system. Freed objects are kept in the pool to be reused by the
+    /// next objects of the same size. The chunks are never given back to the system.
+    ///
+    /// The pool is disabled by default. Objects that were created while the pool was disabled are unaffected by
+    /// enabling it later and the other way around, so the pool can be enabled at any time (e.g. right before loading
+    /// a big form).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MemoryPool
+    {
+    public:
+
+        /// Objects that are bigger than this are allocated with the global operator new, even when the pool is enabled
+        static const std::size_t MaxBlockSize = 4096;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables allocating new objects from the pool
+        ///
+        /// @param enabled  Should objects that are created from now on be allocated from the pool?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether new objects are allocated from the pool
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled()
+        {
+            return m_enabled.load(std::memory_order_relaxed);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the pool has reserved from the system, in bytes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getReservedMemory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of blocks that are currently in use
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getUsedBlockCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Takes a block of at least the given size from the pool
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* allocate(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a block to the pool, the size must be the same as the one passed to allocate
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void deallocate(void* pointer, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static std::atomic<bool> m_enabled;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Allocator that allocates single objects from the MemoryPool when the pool was enabled when it was created
+    ///
+    /// Every allocator remembers whether it uses the pool, so memory is always returned to the place it came from.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class PoolAllocator
+    {
+    public:
+
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef PoolAllocator<U> other;
+        };
+
+        PoolAllocator() :
+            m_pooled{MemoryPool::isEnabled()}
+        {
+        }
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) :
+            m_pooled{other.isPooled()}
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            if (m_pooled && (count == 1) && (sizeof(T) <= MemoryPool::MaxBlockSize))
+                return static_cast<T*>(MemoryPool::allocate(sizeof(T)));
+            else
+                return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* pointer, std::size_t count)
+        {
+            if (m_pooled && (count == 1) && (sizeof(T) <= MemoryPool::MaxBlockSize))
+                MemoryPool::deallocate(pointer, sizeof(T));
+            else
+                ::operator delete(pointer);
+        }
+
+        bool isPooled() const
+        {
+            return m_pooled;
+        }
+
+    private:
+
+        bool m_pooled;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+    {
+        return left.isPooled() == right.isPooled();
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+    {
+        return left.isPooled() != right.isPooled();
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Creates an object like std::make_shared does, but allocates it from the MemoryPool when the pool is enabled
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makePooled(Args&&... args)
+    {
+        return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_POOL_HPP
@@ -0,0 +1,265 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects timings and counters of the gui, to find out where the frame time goes
+    ///
+    /// The measurements are only made when TGUI was build with the TGUI_ENABLE_PROFILING option. Without that option the
+    /// instrumentation is not even compiled into the library and all statistics remain empty.
+    /// When compiled in, nothing is measured until setEnabled(true) is called.
+    ///
+    /// The following scopes are measured, each with a category and a name:
+    /// - Gui: handleEvent, updateTime and draw
+    /// - Draw and Update: the time spent in every widget type, including the widgets inside it
+    /// - Layout: recalculating layouts
+    /// - Text: splitting text in lines and creating the glyphs
+    /// - Texture: loading images
+    ///
+    /// A frame ends every time a gui finishes drawing.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        struct ScopeStats
+        {
+            std::size_t calls = 0; ///< Amount of times that the scope was entered
+            sf::Time time;         ///< Total time spent inside the scope (recursive calls are only counted once)
+        };
+
+        struct FrameStats
+        {
+            sf::Time frameTime;                        ///< Time between the end of the previous frame and the end of this one
+            std::map<std::string, ScopeStats> scopes;  ///< Statistics per scope, with "category/name" as key (e.g. "Draw/Button")
+            std::size_t drawCalls = 0;                 ///< Amount of textures and texts that were drawn
+            std::size_t vertices = 0;                  ///< Amount of vertices in those draw calls
+            std::size_t scissorChanges = 0;            ///< Amount of times that the clipping area was changed
+            std::size_t signalEmissions = 0;           ///< Amount of signals that were send by widgets
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether TGUI was build with profiling support (TGUI_ENABLE_PROFILING)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAvailable();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts or stops collecting statistics
+        ///
+        /// @param enabled  Should the profiler measure the gui?
+        ///
+        /// The profiler is disabled by default, so that it has no overhead until it is needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the profiler is collecting statistics
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled()
+        {
+            return m_enabled.load(std::memory_order_relaxed);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the statistics of the last frame that was completed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FrameStats getLastFrameStats();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording every measured scope as a trace event
+        ///
+        /// Events that were recorded earlier are removed. Recording only happens while the profiler is enabled.
+        /// To limit the memory usage, no more than a million events are recorded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void startTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops recording trace events, the recorded events are kept until the next call to startTrace
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded trace events in the Chrome trace event format
+        ///
+        /// The json can be opened in chrome://tracing or other trace viewers. The counters are added as counter events
+        /// at the end of every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recorded trace events to a file in the Chrome trace event format
+        ///
+        /// @param filename  Filename of the json file to create
+        ///
+        /// @exception Exception when the file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void saveTrace(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the instrumentation inside TGUI, don't call these functions directly
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endFrame();
+        static void countDrawCall(std::size_t vertexCount);
+        static void countScissorChange();
+        static void countSignalEmission();
+        static sf::Time beginScope(const char* category, const char* name);
+        static void endScope(const char* category, const char* name, sf::Time startTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct TraceEvent
+        {
+            std::string name;
+            const char* category;
+            unsigned int thread;
+            sf::Int64 start;    // In microseconds
+            sf::Int64 duration; // In microseconds
+        };
+
+        struct FrameCounters
+        {
+            sf::Int64 time;
+            std::size_t drawCalls;
+            std::size_t vertices;
+            std::size_t scissorChanges;
+            std::size_t signalEmissions;
+        };
+
+        // Returns a small number for the thread, as trace viewers show the threads in order of their id
+        static unsigned int getThreadIndex(std::thread::id id);
+
+        static std::atomic<bool> m_enabled;
+        static std::mutex m_mutex;
+        static sf::Clock m_clock;
+        static sf::Time m_lastFrameEnd;
+        static FrameStats m_currentFrame;
+        static FrameStats m_lastFrame;
+
+        // Amount of times that each scope is currently entered on each thread, to not count recursive scopes twice
+        static std::map<std::pair<std::thread::id, std::string>, unsigned int> m_activeScopes;
+
+        static bool m_tracing;
+        static std::vector<TraceEvent> m_traceEvents;
+        static std::vector<FrameCounters> m_traceCounters;
+        static std::map<std::thread::id, unsigned int> m_threadIndices;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Measures the time until the object is destroyed, used by the TGUI_PROFILE_SCOPE macro
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ProfileScope
+    {
+    public:
+
+        ProfileScope(const char* category, const char* name) :
+            m_category{category},
+            m_name    {name},
+            m_active  {Profiler::isEnabled()}
+        {
+            if (m_active)
+                m_startTime = Profiler::beginScope(m_category, m_name);
+        }
+
+        ProfileScope(const char* category, const std::string& name) :
+            ProfileScope{category, name.c_str()}
+        {
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        ~ProfileScope()
+        {
+            if (m_active)
+                Profiler::endScope(m_category, m_name, m_startTime);
+        }
+
+    private:
+
+        const char* m_category;
+        const char* m_name;
+        bool m_active;
+        sf::Time m_startTime;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define TGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TGUI_PROFILE_CONCAT(a, b) TGUI_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef TGUI_ENABLE_PROFILING
+    #define TGUI_PROFILE_SCOPE(category, name) tgui::ProfileScope TGUI_PROFILE_CONCAT(tguiProfileScope, __LINE__){category, name}
+    #define TGUI_PROFILE_END_FRAME() tgui::Profiler::endFrame()
+    #define TGUI_PROFILE_DRAW_CALL(vertexCount) tgui::Profiler::countDrawCall(vertexCount)
+    #define TGUI_PROFILE_SCISSOR_CHANGE() tgui::Profiler::countScissorChange()
+    #define TGUI_PROFILE_SIGNAL() tgui::Profiler::countSignalEmission()
+#else
+    #define TGUI_PROFILE_SCOPE(category, name) ((void)0)
+    #define TGUI_PROFILE_END_FRAME() ((void)0)
+    #define TGUI_PROFILE_DRAW_CALL(vertexCount) ((void)0)
+    #define TGUI_PROFILE_SCISSOR_CHANGE() ((void)0)
+    #define TGUI_PROFILE_SIGNAL() ((void)0)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RICH_TEXT_HPP
+#define TGUI_RICH_TEXT_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Text with markup that has been parsed into runs of characters that share the same style and color
+    ///
+    /// The markup is only parsed once, the runs can then be turned into vertices for any font and character size.
+    /// All runs are drawn with the same font texture, so the whole text can be drawn at once.
+    ///
+    /// Markup:
+    /// - *text* makes the text bold
+    /// - ~text~ makes the text italic
+    /// - _text_ underlines the text
+    /// - #name changes the color of the text that follows, the whitespace behind the color name is removed.
+    ///   The name is looked up in the colors that are passed to the constructor or is otherwise read as a hexadecimal rrggbb value.
+    /// - A backslash in front of one of the above characters shows the character instead of using it as markup
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RichText
+    {
+    public:
+
+        struct Run
+        {
+            std::size_t first;  ///< Index of the first character of the run in the text without markup
+            std::size_t length; ///< Amount of characters in the run
+            sf::Uint32 style;   ///< Combination of sf::Text::Style flags
+            sf::Color color;    ///< Color of the characters
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor, for an empty text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RichText() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses the markup
+        ///
+        /// @param markup        Text containing markup
+        /// @param colors        Colors that can be used by name in the markup
+        /// @param defaultColor  Color of the text in front of the first color change
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RichText(const sf::String& markup, const std::map<sf::String, sf::Color>& colors, const sf::Color& defaultColor = sf::Color::White);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text without the markup
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getText() const
+        {
+            return m_text;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the runs, which are in the order of the text and together contain all its characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Run>& getRuns() const
+        {
+            return m_runs;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the vertices of all characters to a vertex array
+        ///
+        /// @param font           Font used to draw the text
+        /// @param characterSize  Text size
+        /// @param vertices       Vertices to which the glyphs are appended, to be drawn as sf::Triangles with the font texture
+        ///
+        /// @return Size of the text, measured from the top left of the first line
+        ///
+        /// The glyphs are positioned in the same way as sf::Text would position them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f createVertices(const sf::Font& font, unsigned int characterSize, std::vector<sf::Vertex>& vertices) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color with the given name, or the color that the name represents as hexadecimal value
+        ///
+        /// @param name    Name of the color, or a hexadecimal rrggbb value
+        /// @param colors  Named colors
+        ///
+        /// @return The color, or white when the name isn't a known color and not a hexadecimal value
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Color findColor(const sf::String& name, const std::map<sf::String, sf::Color>& colors);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::String m_text;
+        std::vector<Run> m_runs;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RICH_TEXT_HPP
@@ -29,6 +29,8 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Callback.hpp>
+#include <TGUI/MemoryPool.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <map>
 #include <deque>
@@ -207,6 +209,19 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Name and parameter types of a signal, shared by all widgets that have the signal.
+        // The signals of a widget form a chain, which ends with the signals that were added by the Widget base class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API SignalInfo
+        {
+            const SignalInfo* next;
+            std::string name;
+            std::vector<std::vector<std::string>> types;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         template <typename Func, typename... Args>
         struct isFunctionConvertible
         {
@@ -239,7 +254,7 @@ namespace tgui
     {
     public:
 
-        Signal(std::vector<std::vector<std::string>>&& types);
+        Signal(const std::vector<std::vector<std::string>>& types);
 
         template <typename Func, typename... Args>
         void connect(unsigned int id, Func func, Args... args)
@@ -284,12 +299,12 @@ namespace tgui
             assert(acceptedType.size() == 1);
 
             std::size_t count = 0;
-            for (std::size_t i = 0; i < m_allowedTypes.size(); ++i)
+            for (std::size_t i = 0; i < m_allowedTypes->size(); ++i)
             {
-                if (acceptedType[0] == m_allowedTypes[i])
+                if (acceptedType[0] == (*m_allowedTypes)[i])
                     return count;
 
-                count += m_allowedTypes[i].size();
+                count += (*m_allowedTypes)[i].size();
             }
 
             throw Exception{"Failed to bind parameter to callback function. Parameter is of wrong type."};
@@ -300,7 +315,7 @@ namespace tgui
         std::map<unsigned int, std::function<void()>> m_functions;
         std::map<unsigned int, std::function<void(const Callback&)>> m_functionsEx;
 
-        std::vector<std::vector<std::string>> m_allowedTypes;
+        const std::vector<std::vector<std::string>>* m_allowedTypes; // Owned by the SignalInfo, which is never destroyed
 
         friend class SignalWidgetBase; // Only needed for m_functionsEx
     };
@@ -359,10 +374,11 @@ namespace tgui
 
             for (auto& signalName : signalNameList)
             {
-                if (m_signals.find(toLower(signalName)) != m_signals.end())
+                const priv::SignalInfo* info = findSignalInfo(toLower(signalName));
+                if (info)
                 {
                     try {
-                        m_signals[toLower(signalName)]->connect(m_lastId, func, args...);
+                        getSignal(*info).connect(m_lastId, func, args...);
                         m_lastId++;
                     }
                     catch (const Exception& e) {
@@ -375,12 +391,12 @@ namespace tgui
                         throw Exception{"Cannot connect to unknown signal '" + signalName + "'."};
                     else
                     {
-                        assert(!m_signals.empty());
+                        assert(m_signalInfo != nullptr);
 
-                        for (auto& signal : m_signals)
+                        for (info = m_signalInfo; info != nullptr; info = info->next)
                         {
                             try {
-                                signal.second->connect(m_lastId, func, args...);
+                                getSignal(*info).connect(m_lastId, func, args...);
                                 m_lastId++;
                             }
                             catch (const Exception& e) {
@@ -416,10 +432,11 @@ namespace tgui
 
             for (auto& name : signalNameList)
             {
-                if (m_signals.find(toLower(name)) != m_signals.end())
+                const priv::SignalInfo* info = findSignalInfo(toLower(name));
+                if (info)
                 {
                     try {
-                        m_signals[toLower(name)]->connectEx(m_lastId, func, args...);
+                        getSignal(*info).connectEx(m_lastId, func, args...);
                         m_lastId++;
                     }
                     catch (const Exception& e) {
@@ -432,12 +449,12 @@ namespace tgui
                         throw Exception{"Cannot connect to unknown signal '" + name + "'."};
                     else
                     {
-                        assert(!m_signals.empty());
+                        assert(m_signalInfo != nullptr);
 
-                        for (auto& signal : m_signals)
+                        for (info = m_signalInfo; info != nullptr; info = info->next)
                         {
                             try {
-                                signal.second->connectEx(m_lastId, func, args...);
+                                getSignal(*info).connectEx(m_lastId, func, args...);
                                 m_lastId++;
                             }
                             catch (const Exception& e) {
@@ -483,12 +500,13 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Add a new signal that people can bind.
+        // The signal only gets storage for its handlers when something is connected to it.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename... T>
         void addSignal(std::string&& name)
         {
-            assert(m_signals[toLower(name)] == nullptr);
-            m_signals[toLower(name)] = std::make_shared<Signal>(priv::extractTypes<T...>::get());
+            assert(findSignalInfo(toLower(name)) == nullptr);
+            m_signalInfo = registerSignal(m_signalInfo, toLower(name), &priv::extractTypes<T...>::get);
         }
 
 
@@ -504,8 +522,25 @@ namespace tgui
         template <typename... Args>
         void sendSignal(std::string&& name, Args... args)
         {
-            assert(m_signals[toLower(name)] != nullptr);
-            auto& signal = *m_signals[toLower(name)];
+            TGUI_PROFILE_SIGNAL();
+
+            // Most signals never get a handler, in which case there is nothing to do
+            if (m_signals.empty())
+            {
+                assert(findSignalInfo(toLower(name)) != nullptr);
+                return;
+            }
+
+            const auto it = m_signals.find(toLower(name));
+            if (it == m_signals.end())
+            {
+                assert(findSignalInfo(toLower(name)) != nullptr);
+                return;
+            }
+
+            // Keep the signal alive in case a signal handler disconnects it
+            const std::shared_ptr<Signal> signalPtr = it->second;
+            auto& signal = *signalPtr;
 
             if (signal.m_functionsEx.empty())
             {
@@ -532,9 +567,23 @@ namespace tgui
 
         std::vector<std::string> extractSignalNames(std::string input);
 
+        // Returns the info of the signal with the given lowercase name, or nullptr when the widget has no such signal
+        const priv::SignalInfo* findSignalInfo(const std::string& name) const;
+
+        // Returns the handler storage of the signal, which is created the first time it is needed
+        Signal& getSignal(const priv::SignalInfo& info);
+
+        // Returns the shared info of a signal, which is only created the first time a widget of this type adds the signal
+        static const priv::SignalInfo* registerSignal(const priv::SignalInfo* next, std::string&& name,
+                                                      std::vector<std::vector<std::string>>(*getTypes)());
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Signals that the widget supports, shared with all other widgets of the same type
+        const priv::SignalInfo* m_signalInfo = nullptr;
+
+        // Handlers of the signals, the map only contains the signals to which something has been connected
         std::map<std::string, std::shared_ptr<Signal>> m_signals;
 
         static unsigned int m_lastId;
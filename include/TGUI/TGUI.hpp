@@ -28,13 +28,22 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/MemoryPool.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/Tween.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RichText.hpp>
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/GlyphOffsets.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/TextValidator.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/HorizontalLayout.hpp>
 #include <TGUI/VerticalLayout.hpp>
 #include <TGUI/Gui.hpp>
 
+#include <TGUI/Loading/AsyncLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
@@ -59,11 +68,13 @@
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/Slider.hpp>
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tab.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Widgets/ThreadedCanvas.hpp>
 #include <TGUI/Widgets/ToolTip.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_LAYOUT_HPP
+#define TGUI_TEXT_LAYOUT_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <unordered_map>
+#include <list>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class DistanceFieldFont;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Text that has been split in lines and converted to glyph quads
+    ///
+    /// A layout never changes after it has been created, so it can be shared between all widgets that show the same text.
+    /// The vertices are white, widgets copy them when they need the text in a different color.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLayout
+    {
+    public:
+
+        struct Line
+        {
+            std::size_t firstVertex; ///< Index of the first vertex of the line
+            std::size_t vertexCount; ///< Amount of vertices in the line (two triangles per glyph)
+            float width;             ///< Width of the line without the whitespace at the end
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits the text in lines and creates the vertices of the glyphs
+        ///
+        /// @param text           Text to layout
+        /// @param font           Font used to draw the text
+        /// @param characterSize  Text size
+        /// @param style          Combination of sf::Text::Style flags
+        /// @param maxWidth       Width after which the text is word-wrapped, or 0 to only break lines on newlines
+        ///
+        /// The vertices of every line are relative to the top left of that line, just like when the line would be an sf::Text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextLayout(const sf::String& text, const sf::Font& font, unsigned int characterSize, sf::Uint32 style, float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits the text in lines and creates the vertices of the glyphs from a distance field atlas
+        ///
+        /// @param text           Text to layout
+        /// @param font           Atlas of the font used to draw the text
+        /// @param characterSize  Text size
+        /// @param style          Combination of sf::Text::Style flags
+        /// @param maxWidth       Width after which the text is word-wrapped, or 0 to only break lines on newlines
+        ///
+        /// The vertices have to be drawn with the atlas texture and the shader of the DistanceFieldFont.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextLayout(const sf::String& text, std::shared_ptr<DistanceFieldFont> font, unsigned int characterSize, sf::Uint32 style, float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the lines in which the text was split
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Line>& getLines() const
+        {
+            return m_lines;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertices of all lines, to be drawn as sf::Triangles with the font texture of the character size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vertex>& getVertices() const
+        {
+            return m_vertices;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of the widest line, including the whitespace at the end of the lines
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getWidth() const
+        {
+            return m_width;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance field atlas of which the vertices use the texture
+        ///
+        /// @return Atlas, or nullptr when the vertices use the texture of the font itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<DistanceFieldFont>& getDistanceFieldFont() const
+        {
+            return m_distanceFieldFont;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds the vertices of a line that starts at the index and returns the index where the next line starts.
+        // The glyph metrics are either those of an sf::Font or of a DistanceFieldFont.
+        template <typename GlyphMetrics>
+        std::size_t addLine(const sf::String& text, std::size_t index, const GlyphMetrics& metrics, unsigned int characterSize, sf::Uint32 style, float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<Line> m_lines;
+        std::vector<sf::Vertex> m_vertices;
+        float m_width = 0;
+        std::shared_ptr<DistanceFieldFont> m_distanceFieldFont;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Cache of text layouts, so that widgets showing the same text don't each have to layout it again
+    ///
+    /// The least recently requested layouts are removed from the cache when it is full.
+    /// Widgets keep their layout alive while they use it, even when it no longer is in the cache.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLayoutCache
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the layout of the text, which is only created when it isn't cached yet
+        ///
+        /// @param text           Text to layout
+        /// @param font           Font used to draw the text
+        /// @param characterSize  Text size
+        /// @param style          Combination of sf::Text::Style flags
+        /// @param maxWidth       Width after which the text is word-wrapped, or 0 to only break lines on newlines
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const TextLayout> getLayout(const sf::String& text, const std::shared_ptr<sf::Font>& font,
+                                                           unsigned int characterSize, sf::Uint32 style, float maxWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of layouts that are kept in the cache
+        ///
+        /// @param capacity  Maximum amount of cached layouts, 0 disables the cache
+        ///
+        /// The default capacity is 1024.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCapacity(std::size_t capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of layouts that are kept in the cache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of layouts that are currently cached
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all layouts from the cache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Entry
+        {
+            std::size_t hash;
+            sf::String text;
+            std::weak_ptr<sf::Font> font;
+            const sf::Font* fontPtr;
+            unsigned int characterSize;
+            sf::Uint32 style;
+            float maxWidth;
+            std::shared_ptr<const TextLayout> layout;
+        };
+
+        // Removes the least recently used entries until the cache is no longer too big
+        static void shrink(std::size_t size);
+
+        // The most recently used layout is in front of the list
+        static std::list<Entry> m_entries;
+        static std::unordered_multimap<std::size_t, std::list<Entry>::iterator> m_lookup;
+        static std::size_t m_capacity;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LAYOUT_HPP
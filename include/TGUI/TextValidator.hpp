@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_VALIDATOR_HPP
+#define TGUI_TEXT_VALIDATOR_HPP
+
+#include <TGUI/Global.hpp>
+
+#include <vector>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Regular expression that is compiled into a state machine which can be fed one character at a time
+    ///
+    /// The supported syntax is the part of the ECMAScript syntax that makes sense for validating input:
+    /// literals, '.', character classes (including ranges, negation and the \\d, \\w and \\s escapes), groups,
+    /// alternation and the *, +, ? and {n,m} quantifiers. The pattern always has to match the entire text.
+    ///
+    /// The pattern is interpreted as UTF-8 and the text is checked per unicode code point.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextValidator
+    {
+    public:
+
+        typedef int State;
+
+        /// State in which no more text can lead to a match
+        static const State Rejected = -1;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles the pattern
+        ///
+        /// @param pattern  Regular expression that the text has to match
+        ///
+        /// @throw Exception when the pattern is invalid or too complex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextValidator(const std::string& pattern = ".*");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pattern that was compiled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getPattern() const
+        {
+            return m_pattern;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether every text is accepted, in which case there is no need to check the text at all
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool acceptsEverything() const
+        {
+            return m_kind == Kind::Everything;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state before any character was fed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getStartState() const
+        {
+            return 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state after feeding one more character
+        ///
+        /// @param state      State after the previous characters
+        /// @param character  Unicode code point of the next character
+        ///
+        /// @return New state, which is Rejected when the text can no longer match
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State next(State state, sf::Uint32 character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text that lead to the given state matches the pattern
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAccepting(State state) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the entire text matches the pattern
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool matches(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The built-in validators of the edit box don't need a transition table
+        enum class Kind
+        {
+            Everything,
+            Int,
+            UInt,
+            Float,
+            Table
+        };
+
+        // Builds the transition table from the pattern
+        void compile();
+
+        // Returns the index of the character class to which the character belongs
+        std::size_t getCharacterClass(sf::Uint32 character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::string m_pattern;
+        Kind m_kind = Kind::Everything;
+
+        // Characters are divided in classes of characters that always lead to the same state.
+        // The boundaries contain the first character of every class except the first one.
+        std::vector<sf::Uint32> m_classBoundaries;
+        std::vector<unsigned int> m_asciiClasses;
+        std::size_t m_classCount = 1;
+
+        // The next state for every combination of state and character class
+        std::vector<State> m_transitions;
+        std::vector<bool> m_accepting;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_VALIDATOR_HPP
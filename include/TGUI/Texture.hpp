@@ -451,7 +451,7 @@ namespace tgui
 
     private:
         std::shared_ptr<TextureData> m_data = std::make_shared<TextureData>();
-        std::vector<sf::Vertex> m_vertices;
+        std::shared_ptr<std::vector<sf::Vertex>> m_vertices; // Shared between copies until one of them changes
 
         sf::Vector2f  m_size;
         sf::IntRect   m_middleRect;
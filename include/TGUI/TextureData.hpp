@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,12 +44,46 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Packed bitmask of the pixels that aren't fully transparent, so that hit testing doesn't need the image.
+    // Every bit can represent a square block of pixels, the bit is set when any pixel in the block is visible.
+    struct TGUI_API AlphaMask
+    {
+        AlphaMask() = default;
+
+        // Creates the mask for the part of the image inside the rect, or for the whole image when the rect is empty
+        AlphaMask(const sf::Image& image, const sf::IntRect& rect, unsigned int scale = 1);
+
+        // Checks the bit of a pixel, relative to the top left of the rect from which the mask was created
+        bool isTransparentPixel(unsigned int x, unsigned int y) const
+        {
+            x /= scale;
+            y /= scale;
+            if ((x >= size.x) || (y >= size.y))
+                return true;
+
+            return (bits[y * wordsPerRow + x / 32] & (sf::Uint32{1} << (x % 32))) == 0;
+        }
+
+        bool isEmpty() const
+        {
+            return bits.empty();
+        }
+
+        std::vector<sf::Uint32> bits;
+        sf::Vector2u  size;
+        unsigned int  wordsPerRow = 0;
+        unsigned int  scale = 1;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     // Used by the Texture class
     struct TGUI_API TextureData
     {
         std::shared_ptr<sf::Image> image;
         sf::Texture   texture;
         sf::IntRect   rect;
+        AlphaMask     alphaMask;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
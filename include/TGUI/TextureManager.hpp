@@ -31,9 +31,13 @@
 #include <TGUI/TextureData.hpp>
 #include <TGUI/Config.hpp>
 
+#include <SFML/System/String.hpp>
+
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,10 +85,156 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the resolution of the alpha masks that are created for loaded images
+        ///
+        /// @param scale  Width and height of the block of pixels that is represented by a single bit in the mask
+        ///
+        /// The alpha mask is used to find out whether the mouse is on a transparent pixel.
+        /// With the default scale of 1 every pixel is checked exactly. A higher scale uses less memory,
+        /// a block is then considered transparent only when all pixels in it are transparent.
+        /// The scale only affects images that are loaded afterwards.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAlphaMaskScale(unsigned int scale);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the resolution of the alpha masks that are created for loaded images
+        ///
+        /// @return Width and height of the block of pixels that is represented by a single bit in the mask
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getAlphaMaskScale();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the loaded images are kept in memory after the texture was created from them
+        ///
+        /// @param keepImages  Should the image remain available in the TextureData?
+        ///
+        /// Transparency checks only use the alpha mask, so the image is only needed when you access it yourself.
+        /// Images are kept by default. This setting only affects images that are loaded afterwards.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setKeepImagesInMemory(bool keepImages);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the loaded images are kept in memory after the texture was created from them
+        ///
+        /// @return Does the TextureData keep the image?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getKeepImagesInMemory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables a cache on disk for the decoded images, so that they don't have to be decoded again on the next run
+        ///
+        /// @param directory  Existing directory in which the decoded images are stored, or an empty string to disable the cache
+        ///
+        /// The pixels of every image that is loaded are written to the directory in an uncompressed format.
+        /// The cached files are named after a hash of the contents of the image file, so when the image file changes then
+        /// it is decoded again instead of using the outdated pixels. Old files are not removed from the directory.
+        ///
+        /// The cache stores what the image loader returned, so it should not be used with an image loader that doesn't always
+        /// return the same pixels for the same file. Images that aren't loaded from a file on disk are never cached.
+        ///
+        /// The cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setImageCacheDirectory(const std::string& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which decoded images are cached
+        ///
+        /// @return Cache directory, or an empty string when the cache is disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const std::string& getImageCacheDirectory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the file in the cache directory in which the decoded pixels of an image are stored
+        ///
+        /// @param filename  Filename of the image
+        ///
+        /// @return Filename of the cached image, or an empty string when the cache is disabled or the image file can't be read
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getImageCacheFilename(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads an image from the disk cache, or decodes it and adds it to the disk cache
+        ///
+        /// @param filename        Filename of the image
+        /// @param imageLoader     Function that decodes the image when it wasn't found in the cache
+        /// @param cacheDirectory  Cache directory as returned by getImageCacheDirectory, or an empty string to bypass the cache
+        ///
+        /// The function doesn't access the settings of the texture manager, so it may be called from any thread.
+        ///
+        /// @return The loaded image, or nullptr when the image loader failed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Image> loadImage(const std::string& filename,
+                                                    const std::function<std::shared_ptr<sf::Image>(const sf::String&)>& imageLoader,
+                                                    const std::string& cacheDirectory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores an image that was already decoded, so that textures can be created from it without loading the file
+        ///
+        /// @param filename  Filename of the image, exactly as it will be passed to getTexture
+        /// @param image     The decoded image
+        ///
+        /// This function may be called from any thread, e.g. to decode images in the background.
+        /// The texture manager takes the image when the first texture is created from the file, after which it is no longer
+        /// stored here. Images that are never used remain stored until clearPreloadedImages is called.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addPreloadedImage(const std::string& filename, std::shared_ptr<sf::Image> image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a decoded image was stored for a file
+        ///
+        /// @param filename  Filename of the image
+        ///
+        /// @return Was addPreloadedImage called for this file and has no texture taken the image yet?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool hasPreloadedImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases all decoded images that were stored with addPreloadedImage
+        ///
+        /// Textures that were already created from these images are not affected.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearPreloadedImages();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        typedef std::map<std::string, std::list<TextureDataHolder>> ImageMap;
+
+        static ImageMap m_imageMap;
+
+        // Location of every texture data inside the image map, so that copying and removing textures doesn't require a search
+        static std::map<const TextureData*, std::pair<ImageMap::iterator, std::list<TextureDataHolder>::iterator>> m_dataLocations;
+
+        static unsigned int m_alphaMaskScale;
+        static bool m_keepImagesInMemory;
+        static std::string m_imageCacheDirectory;
+
+        // Images decoded in advance, which may be added by other threads
+        static std::map<std::string, std::shared_ptr<sf::Image>> m_preloadedImages;
+        static std::mutex m_preloadedImagesMutex;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
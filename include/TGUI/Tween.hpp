@@ -0,0 +1,356 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TWEEN_HPP
+#define TGUI_TWEEN_HPP
+
+#include <TGUI/Widget.hpp>
+#include <TGUI/Borders.hpp>
+#include <TGUI/Color.hpp>
+
+#include <functional>
+#include <vector>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that determines how the value of a tween changes over time
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class Easing
+    {
+        Linear,          ///< Constant speed
+        QuadraticIn,     ///< Starts slow and accelerates
+        QuadraticOut,    ///< Starts fast and decelerates
+        QuadraticInOut,  ///< Accelerates until halfway and then decelerates
+        CubicIn,         ///< Like QuadraticIn but with a stronger acceleration
+        CubicOut,        ///< Like QuadraticOut but with a stronger deceleration
+        CubicInOut,      ///< Like QuadraticInOut but with a stronger acceleration and deceleration
+        SineIn,          ///< Starts slow and accelerates along a sine curve
+        SineOut,         ///< Starts fast and decelerates along a sine curve
+        SineInOut,       ///< Accelerates and decelerates along a sine curve
+        BackOut,         ///< Goes slightly past the end value before settling on it
+        BounceOut        ///< Bounces a few times against the end value
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Applies an easing curve to the progress of an animation
+    ///
+    /// @param easing    Easing curve to use
+    /// @param progress  Fraction of the duration that passed, between 0 and 1
+    ///
+    /// @return Fraction of the distance between the start and end value that has been covered.
+    ///         This is 0 when progress is 0 and 1 when progress is 1, but can lie outside that range in between.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API float applyEasing(Easing easing, float progress);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Description of a property that changes from a start value to an end value over time
+    ///
+    /// The tween does not know which property it changes, it just passes the intermediate values to the setter function.
+    /// This allows animating any numeric property, e.g. the background color of a button:
+    /// @code
+    /// auto renderer = button->getRenderer();
+    /// tgui::Tween tween{sf::Color::White, sf::Color::Red, sf::milliseconds(300),
+    ///                   [renderer](const tgui::Color& color){ renderer->setBackgroundColor(color); }};
+    /// gui.getTweener().add(button, tween);
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Tween
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a tween that changes a number
+        ///
+        /// @param start     Value at the start of the tween
+        /// @param end       Value at the end of the tween
+        /// @param duration  How long it takes to go from the start to the end value
+        /// @param setter    Function that is called with the new value every time the value changes
+        /// @param easing    Curve that determines how the value changes over time
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tween(float start, float end, sf::Time duration, const std::function<void(float)>& setter, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a tween that changes a color
+        ///
+        /// @param start     Color at the start of the tween
+        /// @param end       Color at the end of the tween
+        /// @param duration  How long it takes to go from the start to the end color
+        /// @param setter    Function that is called with the new color every time the color changes
+        /// @param easing    Curve that determines how the color changes over time
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tween(const Color& start, const Color& end, sf::Time duration, const std::function<void(const Color&)>& setter, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a tween that changes borders or padding
+        ///
+        /// @param start     Borders at the start of the tween
+        /// @param end       Borders at the end of the tween
+        /// @param duration  How long it takes to go from the start to the end borders
+        /// @param setter    Function that is called with the new borders every time the borders change
+        /// @param easing    Curve that determines how the borders change over time
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Tween(const Borders& start, const Borders& end, sf::Time duration, const std::function<void(const Borders&)>& setter, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes to go from the start to the end value
+        ///
+        /// @return Duration of the tween
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getDuration() const
+        {
+            return m_duration;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Colors and borders are animated per component, a number only uses the first component
+        float m_start[4];
+        float m_end[4];
+        unsigned int m_components;
+
+        sf::Time m_duration;
+        Easing m_easing;
+
+        std::function<void(const float*)> m_setter;
+
+        friend class Tweener;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Group of tweens that are played after each other or simultaneously
+    ///
+    /// @code
+    /// tgui::Timeline timeline;
+    /// timeline.then(growTween).with(fadeInTween).then(colorTween);
+    /// gui.getTweener().add(widget, timeline);
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Timeline
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a tween that starts when all tweens that were added earlier have finished
+        ///
+        /// @param tween  The tween to add
+        ///
+        /// @return Reference to the timeline, so that calls can be chained
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Timeline& then(const Tween& tween);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a tween that starts at the same time as the tween that was added before it
+        ///
+        /// @param tween  The tween to add
+        ///
+        /// @return Reference to the timeline, so that calls can be chained
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Timeline& with(const Tween& tween);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Waits a while before starting the tween that is added next with the then function
+        ///
+        /// @param time  Time to wait after all tweens that were added earlier have finished
+        ///
+        /// @return Reference to the timeline, so that calls can be chained
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Timeline& wait(sf::Time time);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the time it takes to play the entire timeline
+        ///
+        /// @return Duration of the timeline
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getDuration() const
+        {
+            return m_duration;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The tweens with the time at which they start
+        std::vector<std::pair<sf::Time, Tween>> m_tweens;
+
+        // Start time of the last tween added with the then function
+        sf::Time m_groupStart;
+
+        sf::Time m_duration;
+
+        friend class Tweener;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Plays tweens
+    ///
+    /// All running tweens are stored next to each other and updated in a single loop, so that many tweens can run at the
+    /// same time without every widget having to be updated. The gui has its own tweener, see Gui::getTweener.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Tweener
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts playing a tween
+        ///
+        /// @param widget  The widget whose property is being animated
+        /// @param tween   The tween to play
+        /// @param delay   Time to wait before the tween starts
+        ///
+        /// The widget is invalidated each time the value changes. The tween stops when the widget is destroyed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void add(const Widget::Ptr& widget, const Tween& tween, sf::Time delay = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts playing all tweens in a timeline
+        ///
+        /// @param widget    The widget whose properties are being animated
+        /// @param timeline  The tweens to play
+        /// @param delay     Time to wait before the timeline starts
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void add(const Widget::Ptr& widget, const Timeline& timeline, sf::Time delay = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all tweens that animate a certain widget
+        ///
+        /// @param widget  The widget whose tweens should be stopped
+        /// @param finish  Should the properties be set to their end values? Otherwise they keep their current values.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stop(const Widget::Ptr& widget, bool finish = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all tweens without changing the properties any further
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tweens that are still running or waiting to start
+        ///
+        /// @return Amount of tweens
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTweenCount() const
+        {
+            return m_states.size() + m_newTweens.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Advances all tweens
+        ///
+        /// @param elapsedTime  Time passed since the last update
+        ///
+        /// This function is called automatically by the gui for its own tweener.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Passes the value at the given progress to the setter and invalidates the widget
+        void apply(std::size_t index, float progress);
+
+        // Removes the tweens that have finished or were stopped
+        void removeFinishedTweens();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Everything that is needed every frame is stored in one array, the setters and widgets are only accessed when
+        // a value actually changes. All three arrays have the same size and are indexed the same way.
+        struct TweenState
+        {
+            float start[4];
+            float end[4];
+            unsigned int components;
+            Easing easing;
+            float delay;
+            float duration;
+            float elapsed;
+            bool finished;
+        };
+
+        std::vector<TweenState> m_states;
+        std::vector<std::function<void(const float*)>> m_setters;
+        std::vector<std::weak_ptr<Widget>> m_widgets;
+
+        // Tweens that are added from within a setter are only stored in the arrays after the update
+        struct NewTween
+        {
+            TweenState state;
+            std::function<void(const float*)> setter;
+            std::weak_ptr<Widget> widget;
+        };
+
+        std::vector<NewTween> m_newTweens;
+        bool m_updating = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TWEEN_HPP
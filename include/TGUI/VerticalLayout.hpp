@@ -85,7 +85,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<VerticalLayout>(*this);
+            return makePooled<VerticalLayout>(*this);
         }
 
 
@@ -476,6 +476,20 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the widget that its visual appearance has changed
+        ///
+        /// The area occupied by the widget is marked as dirty in the gui, so that Gui::needsRedraw will return true.
+        /// Containers that use a render cache will redraw their cached contents the next time they are drawn.
+        /// The setters of the widgets and their renderers, events and animations already call this function. You only have to
+        /// call it yourself when the widget changes in a way that TGUI can't see, e.g. when you modify a texture that it draws.
+        ///
+        /// @see Container::setRenderCacheEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -491,6 +505,21 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the update function has to be called every frame (e.g. because an animation is still running).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Asks the parent to call the update function of this widget every frame until isUpdateRequired returns false.
+        /// Widgets that don't need to be updated are skipped by their parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -597,6 +626,13 @@ namespace tgui
         virtual void reload(const std::string& primary = "", const std::string& secondary = "", bool force = false);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks an area, relative to the parent container, as dirty. Widgets that draw outside of their own bounds (e.g. the
+        // open menu of a menu bar) use this to report the extra area from their invalidate function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateArea(const sf::FloatRect& area);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse enters the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -669,6 +705,9 @@ namespace tgui
         // Show animations
         std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
 
+        // Is the widget in the list of widgets that get updated by the parent?
+        bool m_updateScheduled = false;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container;
@@ -130,6 +130,28 @@ namespace tgui
         using Transformable::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the contents of the canvas are kept when its size changes
+        ///
+        /// @param keepContents  Should the drawn contents be kept when resizing the canvas?
+        ///
+        /// By default the canvas is cleared every time its size changes.
+        ///
+        /// The texture of the canvas only becomes larger when the new size doesn't fit inside it, and then grows by more than
+        /// needed. Changing the size regularly (e.g. while the window is being resized) thus rarely recreates the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setKeepContentsOnResize(bool keepContents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the contents of the canvas are kept when its size changes
+        ///
+        /// @return Are the drawn contents kept when resizing the canvas?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getKeepContentsOnResize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Clear the entire canvas with a single color
         ///
@@ -192,7 +214,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<Canvas>(*this);
+            return makePooled<Canvas>(*this);
         }
 
 
@@ -205,8 +227,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::RenderTexture m_renderTexture;
+        sf::RenderTexture m_renderTexture; // Can be larger than the canvas, only the top left part is shown
         sf::Sprite        m_sprite;
+
+        bool m_keepContentsOnResize = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
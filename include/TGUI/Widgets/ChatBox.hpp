@@ -552,7 +552,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<ChatBox>(*this);
+            return makePooled<ChatBox>(*this);
         }
 
 
@@ -575,7 +575,7 @@ namespace tgui
         bool m_linesStartFromTop = false;
         bool m_newLinesBelowOthers = true;
 
-        Scrollbar::Ptr m_scroll = std::make_shared<Scrollbar>();
+        Scrollbar::Ptr m_scroll = makePooled<Scrollbar>();
 
         std::deque<Line> m_lines;
 
@@ -693,6 +693,16 @@ namespace tgui
         using WidgetPadding::setPadding;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,7 +123,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<CheckBox>(*this);
+            return makePooled<CheckBox>(*this);
         }
 
 
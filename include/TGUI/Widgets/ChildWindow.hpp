@@ -527,7 +527,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<ChildWindow>(*this);
+            return makePooled<ChildWindow>(*this);
         }
 
 
@@ -565,9 +565,9 @@ namespace tgui
         sf::String     m_minimizeButtonText = "-";
         sf::String     m_maximizeButtonText = "+";
 
-        std::shared_ptr<Button> m_closeButton = std::make_shared<Button>();
-        std::shared_ptr<Button> m_minimizeButton = std::make_shared<Button>();
-        std::shared_ptr<Button> m_maximizeButton = std::make_shared<Button>();
+        std::shared_ptr<Button> m_closeButton = makePooled<Button>();
+        std::shared_ptr<Button> m_minimizeButton = makePooled<Button>();
+        std::shared_ptr<Button> m_maximizeButton = makePooled<Button>();
 
         bool m_mouseDownOnTitleBar = false;
         bool m_keepInParent = false;
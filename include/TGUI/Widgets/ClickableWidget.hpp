@@ -106,7 +106,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<ClickableWidget>(*this);
+            return makePooled<ClickableWidget>(*this);
         }
 
 
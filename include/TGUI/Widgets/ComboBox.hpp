@@ -630,7 +630,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<ComboBox>(*this);
+            return makePooled<ComboBox>(*this);
         }
 
 
@@ -678,7 +678,7 @@ namespace tgui
         std::size_t m_nrOfItemsToDisplay = 0;
 
         // Internally a list box is used to store all items
-        ListBox::Ptr m_listBox = std::make_shared<ListBox>();
+        ListBox::Ptr m_listBox = makePooled<ListBox>();
 
         Label m_text;
 
@@ -27,8 +27,9 @@
 
 
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/TextValidator.hpp>
+#include <TGUI/GlyphOffsets.hpp>
 
-#include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -252,7 +253,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         unsigned int getTextSize() const
         {
-            return m_textFull.getCharacterSize();
+            return m_characterSize;
         }
 
 
@@ -399,11 +400,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Define how the text input should look like
         ///
-        /// @param regex  Valid regular expression for std::regex to match on text changes
+        /// @param regex  Valid regular expression to match on text changes, see TextValidator for the supported syntax
         ///
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// @throw Exception when the regex is invalid
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -517,18 +520,61 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the state of the input validator after the given amount of characters of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextValidator::State getValidatorState(std::size_t length);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the validator states that depend on the characters starting from the given position in the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textChangedAt(std::size_t position);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateTextPositions();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the glyphs of the displayed text, starting from the character at the given position.
+        // The characters in front of the position didn't change, so their glyphs and offsets are kept.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextGeometry(std::size_t firstChangedCharacter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTextWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the vertices of the selected characters the selected text color and all other vertices the normal text color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextColor();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Only recolors the characters that were selected or deselected since the text color was last updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectionColor();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the vertices of the characters in the range [first, last) the given color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterColor(std::size_t first, std::size_t last, const sf::Color& color);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<EditBox>(*this);
+            return makePooled<EditBox>(*this);
         }
 
 
@@ -538,6 +584,12 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -559,8 +611,11 @@ namespace tgui
         sf::String    m_displayedText;
         sf::String    m_text;
 
-        std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        TextValidator m_validator;
+
+        // The state of the validator after each prefix of m_text, filled on demand when typing.
+        // Every change to m_text has to remove the states after the changed position.
+        std::vector<TextValidator::State> m_validatorStates;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -589,11 +644,27 @@ namespace tgui
         // The blinking caret
         sf::RectangleShape  m_caret;
 
-        // We need three SFML texts to draw our text, and one more for calculations.
-        sf::Text m_textBeforeSelection;
-        sf::Text m_textSelection;
-        sf::Text m_textAfterSelection;
-        sf::Text m_textFull;
+        // The glyphs of the displayed text, relative to the position of the text and drawn with the font texture.
+        // The selection is drawn by giving the vertices of the selected characters another color.
+        std::vector<sf::Vertex> m_textVertices;
+
+        // The distance from the start of the text to every character
+        GlyphOffsets m_characterOffsets;
+
+        // Index of the first vertex of every character, with one extra element containing the amount of vertices
+        std::vector<std::size_t> m_characterVertices;
+
+        // The characters whose vertices currently have the selected text color
+        std::size_t m_coloredSelectionFirst = 0;
+        std::size_t m_coloredSelectionLast = 0;
+
+        // The character size that is used for the displayed text
+        unsigned int m_characterSize = 0;
+
+        // The position where the displayed text is drawn
+        sf::Vector2f m_textPosition;
+
+        // The text that is shown when the edit box is empty
         sf::Text m_defaultText;
 
         // Is there a possibility that the user is going to double click?
@@ -834,6 +905,16 @@ namespace tgui
         void setDefaultTextStyle(sf::Uint32 style);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,7 +240,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<Grid>(*this);
+            return makePooled<Grid>(*this);
         }
 
 
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/TextLayout.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -405,7 +406,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<Label>(*this);
+            return makePooled<Label>(*this);
         }
 
 
@@ -415,12 +416,30 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text, making use of the given size of maximum text width.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the vertices from the text layout, moves every line to its position and gives them the color of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all lines of text with a single draw call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -433,7 +452,11 @@ namespace tgui
         sf::RectangleShape m_background;
 
         sf::String m_string;
-        std::vector<sf::Text> m_lines;
+
+        // The layout is shared with all other labels that show the same text with the same font, size, style and width
+        std::shared_ptr<const TextLayout> m_textLayout;
+        std::vector<sf::Vertex> m_textVertices;
+        std::vector<sf::Vector2f> m_linePositions;
 
         unsigned int m_textSize = 18;
         sf::Uint32 m_textStyle = sf::Text::Style::Regular;
@@ -558,6 +581,16 @@ namespace tgui
         void setBorderColor(const Color& color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
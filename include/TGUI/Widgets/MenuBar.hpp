@@ -272,6 +272,16 @@ namespace tgui
         virtual void setOpacity(float opacity) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the widget that its visual appearance has changed
+        ///
+        /// Besides the menu bar itself, the area of the open menu is marked as dirty. So is the area of the menu that was open
+        /// the previous time this function was called, so that a menu that was closed in the meantime gets erased.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -315,6 +325,12 @@ namespace tgui
         virtual void mouseLeftWidget() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area below the menu bar that is covered by the open menu, or an empty rect when no menu is open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getOpenMenuArea() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -324,7 +340,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<MenuBar>(*this);
+            return makePooled<MenuBar>(*this);
         }
 
 
@@ -367,6 +383,9 @@ namespace tgui
 
         float m_minimumSubMenuWidth = 125;
 
+        // Area of the open menu during the last call to invalidate
+        sf::FloatRect m_invalidatedMenuArea;
+
         friend class MenuBarRenderer;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,7 +213,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<MessageBox>(*this);
+            return makePooled<MessageBox>(*this);
         }
 
 
@@ -225,7 +225,7 @@ namespace tgui
 
         std::vector<Button::Ptr> m_buttons;
 
-        Label::Ptr m_label = std::make_shared<Label>();
+        Label::Ptr m_label = makePooled<Label>();
 
         unsigned int m_textSize = 16;
 
@@ -0,0 +1,350 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SCROLLABLE_PANEL_HPP
+#define TGUI_SCROLLABLE_PANEL_HPP
+
+
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Panel with a vertical scrollbar
+    ///
+    /// The child widgets keep their position while scrolling, they are only drawn and receive mouse events shifted by the
+    /// scrollbar value. Child widgets that lie completely outside the visible part of the panel are not drawn and are skipped
+    /// when looking for the widget below the mouse.
+    ///
+    /// Signals:
+    ///     - Inherited signals from Panel
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ScrollablePanel : public Panel
+    {
+    public:
+
+        typedef std::shared_ptr<ScrollablePanel> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const ScrollablePanel> ConstPtr; ///< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @param size  Size of the panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScrollablePanel(const Layout2d& size = {100, 100});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// @param panelToCopy  Instance to copy
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScrollablePanel(const ScrollablePanel& panelToCopy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        ///
+        /// @param right  Instance to assign
+        ///
+        /// @return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScrollablePanel& operator= (const ScrollablePanel& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new scrollable panel widget
+        ///
+        /// @param size  Size of the panel
+        ///
+        /// @return The new scrollable panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ScrollablePanel::Ptr create(Layout2d size = {100, 100});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another scrollable panel
+        ///
+        /// @param panel  The other scrollable panel
+        ///
+        /// @return The new scrollable panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ScrollablePanel::Ptr copy(ScrollablePanel::ConstPtr panel);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// @param position  New position
+        ///
+        /// @see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(const Layout2d& position) override;
+        using Transformable::setPosition;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the panel
+        ///
+        /// @param size  The new size of the panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setSize(const Layout2d& size) override;
+        using Transformable::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget to the panel
+        ///
+        /// @param widgetPtr   Pointer to the widget you would like to add
+        /// @param widgetName  You can give the widget a unique name to retrieve it from the container later
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void add(const Widget::Ptr& widgetPtr, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the panel
+        ///
+        /// @param widget  Pointer to the widget to remove
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool remove(const Widget::Ptr& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the height of the area that can be scrolled through
+        ///
+        /// @param height  Height of the contents, or 0 to use the bottom of the lowest child widget
+        ///
+        /// When the height is 0 (default), the contents grow when a child widget is added or moved below the current contents,
+        /// they shrink again when a widget is removed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setContentHeight(float height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of the area that can be scrolled through
+        ///
+        /// @return Height of the contents that was set, or 0 when it is calculated from the child widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getContentHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the scrollbar of the panel
+        ///
+        /// @param scrollbar  The new scrollbar, or nullptr to remove the scrollbar
+        ///
+        /// Without a scrollbar, the panel can still be scrolled with the setScrollOffset function.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScrollbar(Scrollbar::Ptr scrollbar);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the scrollbar of the panel
+        ///
+        /// @return The scrollbar, or nullptr when the panel has no scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Scrollbar::Ptr getScrollbar() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Scrolls the contents of the panel
+        ///
+        /// @param offset  Distance between the top of the contents and the top of the panel
+        ///
+        /// The offset is clamped so that the panel is never scrolled beyond the bottom of the contents.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScrollOffset(float offset);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how far the contents of the panel are scrolled
+        ///
+        /// @return Distance between the top of the contents and the top of the panel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getScrollOffset() const
+        {
+            return m_scrollOffset;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the opacity of the panel, its scrollbar and all its child widgets
+        ///
+        /// @param opacity  The opacity of the widgets. 0 means completely transparent, while 1 (default) means fully opaque.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setOpacity(float opacity) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance between the position of the container and a widget that would be drawn inside
+        ///        this container on relative position (0,0).
+        ///
+        /// @return Offset of the widgets in the container, which depends on how far the panel is scrolled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getChildWidgetsOffset() const override
+        {
+            return {0, -m_scrollOffset};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void leftMousePressed(float x, float y) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void leftMouseReleased(float x, float y) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void mouseMoved(float x, float y) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void mouseWheelMoved(int delta, int x, int y) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void mouseNoLongerOnWidget() override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void mouseNoLongerDown() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Widget::Ptr clone() const override
+        {
+            return makePooled<ScrollablePanel>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The child widgets are shifted upwards by the scroll offset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2f getContentOffset() const override
+        {
+            return {0, -m_scrollOffset};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the child widget overlaps with the part of the contents that is currently shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isChildWidgetInView(const Widget& widget) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Grows the contents when a child widget was moved or resized below them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childInvalidated(const sf::FloatRect& area) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widget on the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Recalculates the height of the contents from the child widgets when no fixed height was set
+        void updateContentHeight();
+
+        // Updates the size, position and range of the scrollbar and clamps the scroll offset to the new range
+        void updateScrollbar();
+
+        // Copies the scrollbar value to the scroll offset after the scrollbar handled a mouse event
+        void updateScrollOffsetFromScrollbar();
+
+        bool isScrollbarShown() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        Scrollbar::Ptr m_scroll = makePooled<Scrollbar>();
+
+        // The height set by the user, or 0 to calculate the height of the contents from the child widgets
+        float m_contentHeight = 0;
+        float m_totalContentHeight = 0;
+
+        float m_scrollOffset = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SCROLLABLE_PANEL_HPP
@@ -314,7 +314,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<Scrollbar>(*this);
+            return makePooled<Scrollbar>(*this);
         }
 
 
@@ -373,6 +373,8 @@ namespace tgui
         friend class ComboBox;
         friend class TextBox;
         friend class ChatBox;
+        friend class DataGrid;
+        friend class ScrollablePanel;
 
         friend class ScrollbarRenderer;
 
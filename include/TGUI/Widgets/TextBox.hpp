@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/GlyphOffsets.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -431,6 +432,12 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reload the widget
         ///
@@ -451,7 +458,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<TextBox>(*this);
+            return makePooled<TextBox>(*this);
         }
 
 
@@ -470,6 +477,10 @@ namespace tgui
 
         std::vector<sf::String> m_lines = std::vector<sf::String>{""}; // Did not compile in VS2013 with just braces
 
+        // The character positions of every line, only calculated when the caret is searched on that line.
+        // This is cleared whenever the lines change.
+        std::vector<GlyphOffsets> m_lineOffsets;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -494,7 +505,7 @@ namespace tgui
         std::vector<sf::FloatRect> m_selectionRects;
 
         // The scrollbar
-        Scrollbar::Ptr m_scroll = std::make_shared<Scrollbar>();
+        Scrollbar::Ptr m_scroll = makePooled<Scrollbar>();
 
         // Is there a possibility that the user is going to double click?
         bool m_possibleDoubleClick = false;
@@ -674,6 +685,16 @@ namespace tgui
         void setScrollbar(const std::string& scrollbarThemeFileFilename = "", const std::string& section = "Scrollbar");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the borders.
+        ///
+        /// @param borders  The size of the borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setBorders(const Borders& borders) override;
+        using WidgetBorders::setBorders;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the widget on the render target.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,325 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_THREADED_CANVAS_HPP
+#define TGUI_THREADED_CANVAS_HPP
+
+
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Canvas of which the contents are rendered by a background thread
+    ///
+    /// A render function is called repeatedly on a thread with its own OpenGL context, which draws in one of the buffers of
+    /// the canvas. Finished frames are handed to the gui thread without locking, the widget always shows the newest
+    /// completed frame and never waits for the render thread.
+    ///
+    /// With 3 buffers the render thread never has to wait, frames that were never shown are overwritten by newer ones.
+    /// With 2 buffers the render thread waits until the gui has shown the previous frame before it can render a new one.
+    ///
+    /// @code
+    /// auto canvas = tgui::ThreadedCanvas::create({400, 300});
+    /// canvas->setRenderFunction([](sf::RenderTarget& target){
+    ///     target.clear();
+    ///     target.draw(plot);
+    /// });
+    /// canvas->start();
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ThreadedCanvas : public ClickableWidget
+    {
+    public:
+
+        typedef std::shared_ptr<ThreadedCanvas> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const ThreadedCanvas> ConstPtr; ///< Shared constant widget pointer
+
+        using RenderFunction = std::function<void(sf::RenderTarget& target)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @param size         Size of the canvas
+        /// @param bufferCount  Amount of render textures that are used, either 2 or 3
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThreadedCanvas(const Layout2d& size = {100, 100}, unsigned int bufferCount = 3);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// @param copy  Instance to copy
+        ///
+        /// The copy gets the same render function, but its render thread is not started.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThreadedCanvas(const ThreadedCanvas& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        ///
+        /// @param right  Instance to assign
+        ///
+        /// @return Reference to itself
+        ///
+        /// The render thread of this canvas is stopped.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ThreadedCanvas& operator= (const ThreadedCanvas& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which stops the render thread
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ThreadedCanvas();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new threaded canvas widget
+        ///
+        /// @param size         Size of the canvas
+        /// @param bufferCount  Amount of render textures that are used, either 2 or 3
+        ///
+        /// @return The new canvas
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ThreadedCanvas::Ptr create(Layout2d size = {100, 100}, unsigned int bufferCount = 3);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another threaded canvas
+        ///
+        /// @param canvas  The other canvas
+        ///
+        /// @return The new canvas
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ThreadedCanvas::Ptr copy(ThreadedCanvas::ConstPtr canvas);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Set the position of the widget
+        ///
+        /// This function completely overwrites the previous position.
+        /// See the move function to apply an offset based on the previous position instead.
+        /// The default position of a transformable widget is (0, 0).
+        ///
+        /// @param position  New position
+        ///
+        /// @see move, getPosition
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPosition(const Layout2d& position) override;
+        using Transformable::setPosition;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the widget.
+        ///
+        /// @param size  The new size of the widget
+        ///
+        /// The render thread resizes a buffer before it renders the next frame in it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setSize(const Layout2d& size) override;
+        using Transformable::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that renders a frame
+        ///
+        /// @param renderFunction  Function that is called on the render thread to draw the contents of the canvas
+        ///
+        /// The function draws on the render target that it receives as parameter and should not access the widget itself.
+        ///
+        /// @throw Exception when the render thread is running
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderFunction(const RenderFunction& renderFunction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of frames that the render thread renders per second
+        ///
+        /// @param limit  Maximum frames per second, or 0 to render frames as fast as possible
+        ///
+        /// The default limit is 60 frames per second.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFrameRateLimit(unsigned int limit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of frames that the render thread renders per second
+        ///
+        /// @return Maximum frames per second, or 0 when there is no limit
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getFrameRateLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of render textures that are used
+        ///
+        /// @return 2 for double buffering or 3 for triple buffering
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getBufferCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts the thread that calls the render function
+        ///
+        /// @throw Exception when no render function was set
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void start();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops the render thread and waits until the frame that it was rendering is finished
+        ///
+        /// The last completed frame remains visible.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render thread is running
+        ///
+        /// @return Was start called without calling stop afterwards?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRunning() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of frames that the render thread has completed since the canvas was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCompletedFrameCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the opacity of the widget.
+        ///
+        /// @param opacity  The opacity of the widget. 0 means completely transparent, while 1 (default) means fully opaque.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setOpacity(float opacity) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Redraws the widget when the render thread has finished a new frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// The widget keeps being updated while the render thread is running.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Widget::Ptr clone() const override
+        {
+            return makePooled<ThreadedCanvas>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the newest completed frame on the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Creates the buffers, which don't get a texture until the render thread renders in them
+        void createBuffers();
+
+        // Swaps the front buffer with the newest completed frame, if there is one
+        void takeNewestFrame() const;
+
+        // Takes the buffer that the gui thread released, returns false when the thread was stopped while waiting
+        bool acquireBackBuffer();
+
+        // Function executed by the render thread
+        void renderLoop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        unsigned int m_bufferCount;
+        std::vector<std::unique_ptr<sf::RenderTexture>> m_buffers;
+
+        // Each buffer is either shown by the gui (front), being rendered by the thread (back) or waiting in the mailbox.
+        // The mailbox contains the index of a buffer, combined with a flag when it contains a frame that wasn't shown yet.
+        mutable unsigned int m_frontBuffer = 0;
+        unsigned int m_backBuffer = 0;
+        mutable std::atomic<unsigned int> m_mailbox;
+
+        mutable std::mutex m_mutex;
+        mutable std::condition_variable m_bufferReleased;
+        sf::Vector2u m_bufferSize; // Protected by m_mutex
+
+        RenderFunction m_renderFunction;
+        std::thread m_thread;
+        std::atomic<bool> m_stopRequested;
+        std::atomic<unsigned int> m_frameRateLimit;
+        std::atomic<unsigned int> m_completedFrames;
+
+        mutable sf::Sprite m_sprite;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_THREADED_CANVAS_HPP
@@ -0,0 +1,254 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DATA_GRID_HPP
+#define TGUI_DATA_GRID_HPP
+
+#include <TGUI/Widget.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+
+#include <unordered_map>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Table that only draws the visible rows
+    ///
+    /// It has the same interface as Table, but the cells are plain strings stored per column instead of widgets,
+    /// so it can hold a large amount of rows. Sorting and filtering only change the order in which the rows are shown.
+    ///
+    /// Signals:
+    ///     - RowSelected (a row was selected or deselected)
+    ///         * Optional parameter int: Index of the selected row or -1 when no row is selected
+    ///         * Uses Callback member 'value'
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DataGrid : public Widget
+    {
+    public:
+
+        typedef std::shared_ptr<DataGrid> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const DataGrid> ConstPtr; ///< Shared constant widget pointer
+
+        DataGrid();
+
+        DataGrid(const DataGrid& gridToCopy);
+
+        DataGrid& operator= (const DataGrid& right);
+
+        static DataGrid::Ptr create();
+
+        static DataGrid::Ptr copy(DataGrid::ConstPtr grid);
+
+        virtual Widget::Ptr clone() const override
+        {
+            return makePooled<DataGrid>(*this);
+        }
+
+        virtual void setPosition(const Layout2d& position) override;
+        using Transformable::setPosition;
+
+        virtual void setSize(const Layout2d& size) override;
+        using Transformable::setSize;
+
+        virtual void setFont(const Font& font) override;
+
+        virtual void setOpacity(float opacity) override;
+
+        void setTextSize(unsigned int size);
+        unsigned int getTextSize() const;
+
+        void setHeaderColumns(const std::vector<std::string>& columns);
+        void addRow(const std::vector<std::string>& columns);
+        void removeAllRows();
+
+        std::size_t getColumnCount() const;
+        std::size_t getRowCount() const;
+
+        const sf::String& getItem(std::size_t row, std::size_t column) const;
+        bool changeItem(std::size_t row, std::size_t column, const sf::String& text);
+
+        void setFixedColumnWidth(std::size_t column, float size);
+        void setColumnRatio(std::size_t column, float ratio);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gives a row a different height than the other rows
+        ///
+        /// @param row     Index of the row (in the order in which the rows were added)
+        /// @param height  Height of the row, or 0 to use the default row height again
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRowHeight(std::size_t row, float height);
+        float getRowHeight(std::size_t row) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the rows sorted on the contents of a column
+        ///
+        /// The rows keep their index, only the order in which they are shown changes.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByColumn(std::size_t column, bool ascending = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the rows in a custom order
+        ///
+        /// @param lessThan  Function that gets the indices of two rows and returns whether the first row has to be shown first
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sort(const std::function<bool(std::size_t, std::size_t)>& lessThan);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the rows for which the filter returns true
+        ///
+        /// @param filter  Function that gets the index of a row and returns whether the row should be shown
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const std::function<bool(std::size_t)>& filter);
+        void removeFilter();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the rows that are shown, in the order in which they are shown
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::size_t>& getShownRows() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the row that is shown at a certain height below the header
+        ///
+        /// @param y  Distance from the top of the first row, the scrollbar value is not taken into account
+        ///
+        /// @return Index of the row or -1 when there is no row at that height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowAtHeight(float y) const;
+
+        void setSelectedRow(int row);
+        int getSelectedRow() const;
+
+        void setRowsColor(const sf::Color& color);
+        void setStripesRowsColor(const sf::Color& evenColor, const sf::Color& oddColor);
+        void setTextColor(const sf::Color& color);
+        void setHeaderColor(const sf::Color& backgroundColor, const sf::Color& textColor);
+        void setSelectedRowColor(const sf::Color& color);
+        void setHoveringRowColor(const sf::Color& color);
+
+        void setScrollbar(Scrollbar::Ptr scrollbar);
+        Scrollbar::Ptr getScrollbar() const;
+
+        virtual bool mouseOnWidget(float x, float y) const override;
+
+        virtual void leftMousePressed(float x, float y) override;
+        virtual void leftMouseReleased(float x, float y) override;
+        virtual void mouseMoved(float x, float y) override;
+        virtual void mouseWheelMoved(int delta, int x, int y) override;
+        virtual void mouseNoLongerOnWidget() override;
+        virtual void mouseNoLongerDown() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Recalculates the shown rows after sorting, filtering or adding rows
+        void updateShownRows();
+
+        // Recalculates the prefix sums of the heights of the shown rows (only used when rows have different heights)
+        void updateRowOffsets();
+
+        // Returns the distance between the top of the first row and the top of the row at the given position
+        float getShownRowOffset(std::size_t index) const;
+        float getTotalRowsHeight() const;
+
+        void updateRowHeight();
+        void updateColumnWidths();
+        void updateScrollbar();
+        void updateHeaderTexts();
+
+        // Removes all cached text so that it gets recreated with the current font, text size and color
+        void clearTextCache();
+
+        float getHeaderHeight() const;
+        unsigned int getScrollbarValue() const;
+
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The cells are stored per column
+        std::vector<sf::String> m_headers;
+        std::vector<std::vector<sf::String>> m_columns;
+        std::size_t m_rowCount = 0;
+
+        std::vector<float> m_fixedColumnWidths;
+        std::vector<float> m_columnRatios;
+        std::vector<float> m_columnWidths;
+
+        // Rows with a height of 0 use m_rowHeight. The vector stays empty as long as all rows have the same height.
+        std::vector<float> m_customRowHeights;
+        float m_rowHeight = 20;
+
+        // Indices of all rows in sorted order and the indices of the rows that pass the filter in that same order
+        std::vector<std::size_t> m_sortedRows;
+        std::vector<std::size_t> m_shownRows;
+        std::function<bool(std::size_t)> m_filter;
+
+        // Top of each shown row and the bottom of the last one, only filled when rows have different heights
+        std::vector<float> m_rowOffsets;
+
+        int m_selectedRow = -1;
+        int m_hoveringRow = -1;
+
+        unsigned int m_textSize = 18;
+
+        sf::Color m_textColor = sf::Color::Black;
+        sf::Color m_headerTextColor = sf::Color::White;
+        sf::Color m_headerBackgroundColor = {234, 97, 83};
+        sf::Color m_rowsOddColor = sf::Color::White;
+        sf::Color m_rowsEvenColor = sf::Color::Transparent;
+        sf::Color m_selectedRowColor = {0, 110, 255};
+        sf::Color m_hoveringRowColor = {190, 220, 255};
+        sf::Color m_delimitatorColor = sf::Color::Black;
+
+        Scrollbar::Ptr m_scroll = makePooled<Scrollbar>();
+
+        std::vector<sf::Text> m_headerTexts;
+
+        // The text of the cells that were visible during the last draw call, per column and indexed by row.
+        // Text that remains visible while scrolling doesn't have to be recreated.
+        mutable std::vector<std::unordered_map<std::size_t, sf::Text>> m_textCache;
+        mutable std::size_t m_cachedFirstRow = 0;
+        mutable std::size_t m_cachedLastRow = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DATA_GRID_HPP
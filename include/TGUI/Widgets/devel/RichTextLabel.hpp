@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/RichText.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +39,9 @@ namespace tgui
     ///
     /// Based on SFML-RichText (https://bitbucket.org/jacobalbano/sfml-richtext)
     ///
+    /// The markup is parsed once when the text is set, the text is then drawn with a single draw call.
+    /// See the RichText class for the supported markup.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API RichTextLabel : public ClickableWidget
     {
@@ -133,6 +137,16 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the parsed text, which consists of runs of characters with the same style and color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RichText& getRichText() const
+        {
+            return m_richText;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the character size of the text.
         ///
@@ -190,7 +204,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<RichTextLabel>(*this);
+            return makePooled<RichTextLabel>(*this);
         }
 
 
@@ -200,6 +214,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the vertices of the parsed text and updates the size of the label
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -210,7 +230,9 @@ namespace tgui
         unsigned int m_textSize = 30;
 
         std::map<sf::String, sf::Color> m_colors;
-        std::vector<sf::Text> m_texts;
+
+        RichText m_richText;
+        std::vector<sf::Vertex> m_vertices;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
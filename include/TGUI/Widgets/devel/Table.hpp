@@ -43,7 +43,7 @@ namespace tgui
 
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<Table>(*this);
+            return makePooled<Table>(*this);
         }
 
         virtual void setFont(const Font& font) override;
@@ -86,7 +86,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        tgui::TableRow::Ptr m_header = std::make_shared<tgui::TableRow>();
+        tgui::TableRow::Ptr m_header = tgui::makePooled<tgui::TableRow>();
 
         float m_rowHeight = 20;
 
@@ -52,7 +52,7 @@ namespace tgui
 
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<TableItem>(*this);
+            return makePooled<TableItem>(*this);
         }
 
         void setItem(const Widget::Ptr& widgetPtr, HorizontalAlign align = Left);
@@ -44,7 +44,7 @@ namespace tgui
 
         virtual Widget::Ptr clone() const override
         {
-            return std::make_shared<TableRow>(*this);
+            return makePooled<TableRow>(*this);
         }
 
         /// TODO: Maybe return bool and to check if the row has the table columns number
@@ -64,7 +64,7 @@ namespace tgui
 
     void BoxLayout::addSpace(float ratio)
     {
-        add(std::make_shared<ClickableWidget>(), "");
+        add(makePooled<ClickableWidget>(), "");
         setRatio(m_widgets.size()-1, ratio);
     }
 
@@ -72,7 +72,7 @@ namespace tgui
 
     bool BoxLayout::insertSpace(std::size_t index, float ratio)
     {
-        bool success = insert(index, std::make_shared<ClickableWidget>(), "");
+        bool success = insert(index, makePooled<ClickableWidget>(), "");
         setRatio(index, ratio);
         return success;
     }
@@ -28,10 +28,16 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <SFML/OpenGL.hpp>
 
 #include <stack>
+#include <algorithm>
+#include <cmath>
 #include <cassert>
 #include <fstream>
+#include <cstdio>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,8 +55,12 @@ namespace tgui
 
     Container::Container(const Container& containerToCopy) :
         Widget                   {containerToCopy},
-        m_focusedWidget          {0}
+        m_focusedWidget          {0},
+        m_renderCacheEnabled     {containerToCopy.m_renderCacheEnabled}
     {
+        m_widgets.reserve(containerToCopy.m_widgets.size());
+        m_objName.reserve(containerToCopy.m_objName.size());
+
         // Copy all the widgets
         for (std::size_t i = 0; i < containerToCopy.m_widgets.size(); ++i)
             add(containerToCopy.m_widgets[i]->clone(), containerToCopy.m_objName[i]);
@@ -67,6 +77,7 @@ namespace tgui
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = 0;
+            m_renderCacheEnabled = right.m_renderCacheEnabled;
 
             // Remove all the old widgets
             removeAllWidgets();
@@ -105,6 +116,11 @@ namespace tgui
 
         if (m_opacity < 1)
             widgetPtr->setOpacity(m_opacity);
+
+        if (widgetPtr->isUpdateRequired())
+            widgetPtr->scheduleUpdates();
+
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +160,9 @@ namespace tgui
                     m_widgetBelowMouse = nullptr;
                 }
 
+                // The area behind the widget has to be redrawn
+                widget->invalidate();
+
                 // Unfocus the widget if it was focused
                 if (m_focusedWidget == i+1)
                     unfocusWidgets();
@@ -152,6 +171,13 @@ namespace tgui
                 else if (m_focusedWidget > i+1)
                     m_focusedWidget--;
 
+                // Stop updating the widget
+                if (widget->m_updateScheduled)
+                {
+                    m_scheduledWidgets.erase(std::find(m_scheduledWidgets.begin(), m_scheduledWidgets.end(), widget));
+                    widget->m_updateScheduled = false;
+                }
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
@@ -168,14 +194,20 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         for (auto& widget : m_widgets)
+        {
+            widget->m_updateScheduled = false;
             widget->setParent(nullptr);
+        }
 
         // Clear the lists
         m_widgets.clear();
         m_objName.clear();
+        m_scheduledWidgets.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = 0;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,6 +430,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_renderCacheEnabled = enabled;
+        if (!m_renderCacheEnabled)
+            m_renderCache = nullptr;
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidate()
+    {
+        m_renderCacheValid = false;
+        Widget::invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childInvalidated(const sf::FloatRect& area)
+    {
+        m_renderCacheValid = false;
+
+        if (m_parent && m_visible)
+        {
+            const sf::Vector2f offset = getPosition() + getChildWidgetsOffset();
+            m_parent->childInvalidated({area.left + offset.x, area.top + offset.y, area.width, area.height});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::loadWidgetsFromFile(const std::string& filename)
     {
         std::ifstream in{filename};
@@ -413,14 +477,35 @@ namespace tgui
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), stream);
-
-        std::ofstream out{filename};
+        // The widgets are written to a temporary file first, so that the existing file is left untouched when saving fails
+        const std::string temporaryFilename = filename + ".tmp";
+        std::ofstream out{temporaryFilename};
         if (!out.is_open())
-            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+            throw Exception{"Failed to open '" + temporaryFilename + "' for saving the widgets to it."};
+
+        try
+        {
+            WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), out);
 
-        out << stream.rdbuf();
+            out.close();
+            if (out.fail())
+                throw Exception{"Failed to write the widgets to '" + temporaryFilename + "'."};
+        }
+        catch (...)
+        {
+            out.close();
+            std::remove(temporaryFilename.c_str());
+            throw;
+        }
+
+        // On windows the rename fails when the destination already exists, in which case the old file is removed first.
+        // The temporary file is kept when the second attempt fails as well, so that the saved widgets aren't lost.
+        if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(filename.c_str());
+            if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+                throw Exception{"Failed to replace '" + filename + "' with '" + temporaryFilename + "'."};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,8 +529,8 @@ namespace tgui
         sf::Event event;
         event.type = sf::Event::MouseButtonPressed;
         event.mouseButton.button = sf::Mouse::Left;
-        event.mouseButton.x = static_cast<int>(x - getPosition().x);
-        event.mouseButton.y = static_cast<int>(y - getPosition().y);
+        event.mouseButton.x = static_cast<int>(x - getPosition().x - getContentOffset().x);
+        event.mouseButton.y = static_cast<int>(y - getPosition().y - getContentOffset().y);
 
         // Let the event manager handle the event
         handleEvent(event);
@@ -458,8 +543,8 @@ namespace tgui
         sf::Event event;
         event.type = sf::Event::MouseButtonReleased;
         event.mouseButton.button = sf::Mouse::Left;
-        event.mouseButton.x = static_cast<int>(x - getPosition().x);
-        event.mouseButton.y = static_cast<int>(y - getPosition().y);
+        event.mouseButton.x = static_cast<int>(x - getPosition().x - getContentOffset().x);
+        event.mouseButton.y = static_cast<int>(y - getPosition().y - getContentOffset().y);
 
         // Let the event manager handle the event, but don't let it call mouseNoLongerDown on all widgets
         m_handingMouseReleased = true;
@@ -475,8 +560,8 @@ namespace tgui
 
         sf::Event event;
         event.type = sf::Event::MouseMoved;
-        event.mouseMove.x = static_cast<int>(x - getPosition().x);
-        event.mouseMove.y = static_cast<int>(y - getPosition().y);
+        event.mouseMove.x = static_cast<int>(x - getPosition().x - getContentOffset().x);
+        event.mouseMove.y = static_cast<int>(y - getPosition().y - getContentOffset().y);
         handleEvent(event);
     }
 
@@ -511,8 +596,8 @@ namespace tgui
         sf::Event event;
         event.type = sf::Event::MouseWheelMoved;
         event.mouseWheel.delta = delta;
-        event.mouseWheel.x = static_cast<int>(x - getPosition().x);
-        event.mouseWheel.y = static_cast<int>(y - getPosition().y);
+        event.mouseWheel.x = static_cast<int>(x - getPosition().x - getContentOffset().x);
+        event.mouseWheel.y = static_cast<int>(y - getPosition().y - getContentOffset().y);
 
         // Let the event manager handle the event
         handleEvent(event);
@@ -597,6 +682,7 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i);
                 m_objName.erase(m_objName.begin() + i);
 
+                widget->invalidate();
                 break;
             }
         }
@@ -628,6 +714,7 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_objName.erase(m_objName.begin() + i + 1);
 
+                widget->invalidate();
                 break;
             }
         }
@@ -639,12 +726,27 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Only the widgets with running animations or timers are updated. The list is taken out of the container because
+        // widgets can be removed or scheduled again while they are being updated.
+        std::vector<Widget::Ptr> scheduledWidgets;
+        scheduledWidgets.swap(m_scheduledWidgets);
+        for (auto& widget : scheduledWidgets)
+            widget->m_updateScheduled = false;
+
+        for (auto& widget : scheduledWidgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            // Skip the widget if it was removed from the container in the meantime
+            if (widget->getParent() != this)
+                continue;
+
+            if (widget->isVisible())
+            {
+                TGUI_PROFILE_SCOPE("Update", widget->getWidgetType());
+                widget->update(elapsedTime);
+            }
+
+            if (widget->isUpdateRequired())
+                widget->scheduleUpdates();
         }
 
         m_animationTimeElapsed = {};
@@ -652,6 +754,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || !m_scheduledWidgets.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -670,6 +779,9 @@ namespace tgui
                     if ((m_widgets[i]->m_draggableWidget) || (m_widgets[i]->m_containerWidget))
                     {
                         m_widgets[i]->mouseMoved(mouseX, mouseY);
+                        if (!m_widgets[i]->m_containerWidget)
+                            m_widgets[i]->invalidate();
+
                         return true;
                     }
                 }
@@ -681,6 +793,9 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseMoved(mouseX, mouseY);
+                if (!widget->m_containerWidget)
+                    widget->invalidate();
+
                 return true;
             }
 
@@ -714,6 +829,9 @@ namespace tgui
                 }
 
                 widget->leftMousePressed(mouseX, mouseY);
+                if (!widget->m_containerWidget)
+                    widget->invalidate();
+
                 return true;
             }
             else // The mouse did not went down on a widget, so unfocus the focused widget
@@ -732,7 +850,11 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mouseX, mouseY);
             if (widgetBelowMouse != nullptr)
+            {
                 widgetBelowMouse->leftMouseReleased(mouseX, mouseY);
+                if (!widgetBelowMouse->m_containerWidget)
+                    widgetBelowMouse->invalidate();
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -740,7 +862,12 @@ namespace tgui
             if (!m_handingMouseReleased)
             {
                 for (auto& widget : m_widgets)
+                {
+                    if (widget->m_mouseDown && !widget->m_containerWidget)
+                        widget->invalidate();
+
                     widget->mouseNoLongerDown();
+                }
             }
 
             if (widgetBelowMouse != nullptr)
@@ -765,7 +892,10 @@ namespace tgui
                 #endif
 
                     // Tell the widget that the key was pressed
-                    m_widgets[m_focusedWidget-1]->keyPressed(event.key);
+                    Widget::Ptr widget = m_widgets[m_focusedWidget-1];
+                    widget->keyPressed(event.key);
+                    if (!widget->m_containerWidget)
+                        widget->invalidate();
 
                     return true;
                 }
@@ -793,7 +923,11 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_focusedWidget)
                 {
-                    m_widgets[m_focusedWidget-1]->textEntered(event.text.unicode);
+                    Widget::Ptr widget = m_widgets[m_focusedWidget-1];
+                    widget->textEntered(event.text.unicode);
+                    if (!widget->m_containerWidget)
+                        widget->invalidate();
+
                     return true;
                 }
             }
@@ -810,6 +944,9 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseWheelMoved(event.mouseWheel.delta, event.mouseWheel.x,  event.mouseWheel.y);
+                if (!widget->m_containerWidget)
+                    widget->invalidate();
+
                 return true;
             }
 
@@ -952,7 +1089,7 @@ namespace tgui
         Widget::Ptr widget = nullptr;
         for (std::vector<Widget::Ptr>::reverse_iterator it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
         {
-            if ((*it)->isVisible())
+            if ((*it)->isVisible() && isChildWidgetInView(**it))
             {
                 if ((*it)->mouseOnWidget(x, y))
                 {
@@ -982,14 +1119,82 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        if (m_renderCacheEnabled)
+        {
+            if (!m_renderCacheValid)
+                updateRenderCache(target);
+
+            // The cached texture contains premultiplied colors, so it has to be blended differently than normal drawables
+            if (m_renderCacheValid)
+            {
+                sf::RenderStates cacheStates = states;
+                cacheStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+                target->draw(sf::Sprite{m_renderCache->getTexture()}, cacheStates);
+                TGUI_PROFILE_DRAW_CALL(4);
+                return;
+            }
+        }
+
+        sf::RenderStates childStates = states;
+        childStates.transform.translate(getContentOffset());
+
         // Draw all widgets when they are visible
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i]->m_visible)
-                m_widgets[i]->draw(*target, states);
+            if (m_widgets[i]->m_visible && isChildWidgetInView(*m_widgets[i]))
+            {
+                TGUI_PROFILE_SCOPE("Draw", m_widgets[i]->getWidgetType());
+                m_widgets[i]->draw(*target, childStates);
+            }
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateRenderCache(sf::RenderTarget* target) const
+    {
+        const sf::Vector2u size{static_cast<unsigned int>(std::ceil(getSize().x)), static_cast<unsigned int>(std::ceil(getSize().y))};
+        if ((size.x == 0) || (size.y == 0))
+            return;
+
+        if (!m_renderCache)
+            m_renderCache = std::unique_ptr<sf::RenderTexture>(new sf::RenderTexture);
+
+        if ((m_renderCache->getSize() != size) && !m_renderCache->create(size.x, size.y))
+        {
+            m_renderCache = nullptr;
+            return;
+        }
+
+        // The clipping inside the widgets requires the scissor test to be enabled on the context of the render texture
+        m_renderCache->setActive(true);
+        m_renderCache->clear(sf::Color::Transparent);
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(0, 0, size.x, size.y);
+        TGUI_PROFILE_SCISSOR_CHANGE();
+
+        sf::RenderStates childStates;
+        childStates.transform.translate(getContentOffset());
+
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i]->m_visible && isChildWidgetInView(*m_widgets[i]))
+            {
+                TGUI_PROFILE_SCOPE("Draw", m_widgets[i]->getWidgetType());
+                m_widgets[i]->draw(*m_renderCache, childStates);
+            }
+        }
+
+        m_renderCache->display();
+        m_renderCacheValid = true;
+
+        // Make sure the right opengl context is set again for the clipping code of the caller
+        if (dynamic_cast<sf::RenderWindow*>(target))
+            dynamic_cast<sf::RenderWindow*>(target)->setActive(true);
+        else if (dynamic_cast<sf::RenderTexture*>(target))
+            dynamic_cast<sf::RenderTexture*>(target)->setActive(true);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1013,6 +1218,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        m_renderCacheValid = false;
+        m_redrawNeeded = true;
+        m_dirtyArea = {{0, 0}, getSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::childInvalidated(const sf::FloatRect& area)
+    {
+        m_renderCacheValid = false;
+
+        if ((area.width <= 0) || (area.height <= 0))
+            return;
+
+        if (m_redrawNeeded)
+        {
+            const float left = std::min(m_dirtyArea.left, area.left);
+            const float top = std::min(m_dirtyArea.top, area.top);
+            const float right = std::max(m_dirtyArea.left + m_dirtyArea.width, area.left + area.width);
+            const float bottom = std::max(m_dirtyArea.top + m_dirtyArea.height, area.top + area.height);
+            m_dirtyArea = {left, top, right - left, bottom - top};
+        }
+        else
+        {
+            m_redrawNeeded = true;
+            m_dirtyArea = area;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
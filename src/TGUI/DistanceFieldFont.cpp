@@ -0,0 +1,327 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int atlasWidth = 1024;
+
+    // Smoothstep over the width of a screen pixel, so that the edge stays equally sharp at every scale
+    const char* const distanceFieldShader =
+        "uniform sampler2D texture;\n"
+        "void main()\n"
+        "{\n"
+        "    float distance = texture2D(texture, gl_TexCoord[0].xy).a;\n"
+        "    float width = max(fwidth(distance) * 0.5, 0.001);\n"
+        "    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);\n"
+        "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);\n"
+        "}\n";
+
+    std::unique_ptr<sf::Shader> shader;
+    bool shaderLoaded = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint64 makeGlyphKey(sf::Uint32 codePoint, bool bold)
+    {
+        return (static_cast<sf::Uint64>(bold ? 1 : 0) << 32) | codePoint;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<const sf::Font*, std::shared_ptr<DistanceFieldFont>> DistanceFieldFont::m_enabledFonts;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldFont::DistanceFieldFont(std::shared_ptr<sf::Font> font, unsigned int referenceSize, unsigned int spread) :
+        m_font         {std::move(font)},
+        m_referenceSize{std::max(1u, referenceSize)},
+        m_spread       {spread}
+    {
+        // The top left corner is completely inside, so that it can be used to draw lines
+        m_atlas.create(atlasWidth, 64, sf::Color{255, 255, 255, 0});
+        for (unsigned int y = 0; y < 4; ++y)
+        {
+            for (unsigned int x = 0; x < 4; ++x)
+                m_atlas.setPixel(x, y, sf::Color::White);
+        }
+
+        m_nextX = 5;
+        m_rowHeight = 4;
+
+        m_texture.loadFromImage(m_atlas);
+        m_texture.setSmooth(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldFont::Glyph& DistanceFieldFont::getGlyph(sf::Uint32 codePoint, bool bold)
+    {
+        auto it = m_glyphs.find(makeGlyphKey(codePoint, bold));
+        if (it != m_glyphs.end())
+            return it->second;
+
+        loadGlyphs(sf::String{codePoint}, bold);
+        return m_glyphs[makeGlyphKey(codePoint, bold)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldFont::loadGlyphs(const sf::String& text, bool bold)
+    {
+        if (!m_font)
+            return;
+
+        // Let the font rasterize all missing glyphs before copying its texture
+        std::vector<sf::Uint32> missingGlyphs;
+        for (auto it = text.begin(); it != text.end(); ++it)
+        {
+            if ((m_glyphs.find(makeGlyphKey(*it, bold)) == m_glyphs.end())
+             && (std::find(missingGlyphs.begin(), missingGlyphs.end(), *it) == missingGlyphs.end()))
+            {
+                missingGlyphs.push_back(*it);
+                m_font->getGlyph(*it, m_referenceSize, bold);
+            }
+        }
+
+        if (missingGlyphs.empty())
+            return;
+
+        TGUI_PROFILE_SCOPE("Text", "DistanceFieldFont");
+
+        const sf::Image fontImage = m_font->getTexture(m_referenceSize).copyToImage();
+        for (const auto codePoint : missingGlyphs)
+            addGlyph(codePoint, bold, fontImage);
+
+        if (m_texture.getSize() == m_atlas.getSize())
+            m_texture.update(m_atlas);
+        else
+            m_texture.loadFromImage(m_atlas);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DistanceFieldFont::getKerning(sf::Uint32 first, sf::Uint32 second) const
+    {
+        if (!m_font)
+            return 0;
+
+        return static_cast<float>(m_font->getKerning(first, second, m_referenceSize)) / m_referenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DistanceFieldFont::getLineSpacing() const
+    {
+        if (!m_font)
+            return 0;
+
+        return static_cast<float>(m_font->getLineSpacing(m_referenceSize)) / m_referenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Shader* DistanceFieldFont::getShader()
+    {
+        if (!shaderLoaded)
+        {
+            shaderLoaded = true;
+            if (sf::Shader::isAvailable())
+            {
+                shader = std::unique_ptr<sf::Shader>(new sf::Shader);
+                if (shader->loadFromMemory(distanceFieldShader, sf::Shader::Fragment))
+                {
+                #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                    shader->setUniform("texture", sf::Shader::CurrentTexture);
+                #else
+                    shader->setParameter("texture", sf::Shader::CurrentTexture);
+                #endif
+                }
+                else
+                    shader = nullptr;
+            }
+        }
+
+        return shader.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldFont> DistanceFieldFont::enable(const std::shared_ptr<sf::Font>& font, unsigned int referenceSize)
+    {
+        if (!font)
+            return nullptr;
+
+        auto& distanceFieldFont = m_enabledFonts[font.get()];
+        if (!distanceFieldFont || (distanceFieldFont->getReferenceSize() != referenceSize))
+        {
+            distanceFieldFont = std::make_shared<DistanceFieldFont>(font, referenceSize);
+
+            // Layouts that were created with the normal glyphs should no longer be reused
+            TextLayoutCache::clear();
+        }
+
+        return distanceFieldFont;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldFont::disable(const sf::Font* font)
+    {
+        if (m_enabledFonts.erase(font) > 0)
+            TextLayoutCache::clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldFont> DistanceFieldFont::get(const sf::Font* font)
+    {
+        if (m_enabledFonts.empty())
+            return nullptr;
+
+        auto it = m_enabledFonts.find(font);
+        if (it != m_enabledFonts.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldFont::addGlyph(sf::Uint32 codePoint, bool bold, const sf::Image& fontImage)
+    {
+        const sf::Glyph& fontGlyph = m_font->getGlyph(codePoint, m_referenceSize, bold);
+        const float scale = 1.f / m_referenceSize;
+
+        Glyph& glyph = m_glyphs[makeGlyphKey(codePoint, bold)];
+        glyph.advance = static_cast<float>(fontGlyph.advance) * scale;
+
+        // Whitespace has nothing to draw
+        const int bitmapWidth = fontGlyph.textureRect.width;
+        const int bitmapHeight = fontGlyph.textureRect.height;
+        if ((bitmapWidth <= 0) || (bitmapHeight <= 0))
+            return;
+
+        const int spread = static_cast<int>(m_spread);
+        const unsigned int width = static_cast<unsigned int>(bitmapWidth + 2 * spread);
+        const unsigned int height = static_cast<unsigned int>(bitmapHeight + 2 * spread);
+        if (width + 1 > atlasWidth)
+            return;
+
+        // A pixel is inside the glyph when it is covered for at least half
+        std::vector<bool> inside(width * height, false);
+        for (int y = 0; y < bitmapHeight; ++y)
+        {
+            for (int x = 0; x < bitmapWidth; ++x)
+            {
+                const sf::Color pixel = fontImage.getPixel(fontGlyph.textureRect.left + x, fontGlyph.textureRect.top + y);
+                inside[(y + spread) * width + (x + spread)] = (pixel.a >= 128);
+            }
+        }
+
+        // Find the distance to the nearest pixel on the other side of the edge, within the spread
+        const sf::Vector2u position = allocate(width, height);
+        for (int y = 0; y < static_cast<int>(height); ++y)
+        {
+            for (int x = 0; x < static_cast<int>(width); ++x)
+            {
+                const bool pixelInside = inside[y * width + x];
+
+                int minDistanceSquared = (spread + 1) * (spread + 1);
+                for (int dy = std::max(-spread, -y); dy <= std::min(spread, static_cast<int>(height) - 1 - y); ++dy)
+                {
+                    for (int dx = std::max(-spread, -x); dx <= std::min(spread, static_cast<int>(width) - 1 - x); ++dx)
+                    {
+                        if ((inside[(y + dy) * width + (x + dx)] != pixelInside) && (dx*dx + dy*dy < minDistanceSquared))
+                            minDistanceSquared = dx*dx + dy*dy;
+                    }
+                }
+
+                // The edge lies halfway between the two pixels
+                float value;
+                if (spread > 0)
+                {
+                    const float distance = std::min(std::sqrt(static_cast<float>(minDistanceSquared)) - 0.5f, static_cast<float>(spread));
+                    value = 0.5f + (pixelInside ? distance : -distance) / (2 * spread);
+                }
+                else
+                    value = pixelInside ? 1.f : 0.f;
+
+                const sf::Uint8 alpha = static_cast<sf::Uint8>(std::max(0.f, std::min(1.f, value)) * 255 + 0.5f);
+                m_atlas.setPixel(position.x + x, position.y + y, sf::Color{255, 255, 255, alpha});
+            }
+        }
+
+        glyph.bounds = {(fontGlyph.bounds.left - spread) * scale, (fontGlyph.bounds.top - spread) * scale,
+                        (fontGlyph.bounds.width + 2 * spread) * scale, (fontGlyph.bounds.height + 2 * spread) * scale};
+        glyph.textureRect = {static_cast<float>(position.x), static_cast<float>(position.y), static_cast<float>(width), static_cast<float>(height)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u DistanceFieldFont::allocate(unsigned int width, unsigned int height)
+    {
+        // Glyphs are placed in rows, with an empty pixel between them so that they don't bleed into each other
+        if (m_nextX + width + 1 > atlasWidth)
+        {
+            m_nextX = 0;
+            m_nextY += m_rowHeight + 1;
+            m_rowHeight = 0;
+        }
+
+        if (m_nextY + height > m_atlas.getSize().y)
+        {
+            unsigned int newHeight = m_atlas.getSize().y * 2;
+            while (m_nextY + height > newHeight)
+                newHeight *= 2;
+
+            sf::Image newAtlas;
+            newAtlas.create(atlasWidth, newHeight, sf::Color{255, 255, 255, 0});
+            newAtlas.copy(m_atlas, 0, 0);
+            m_atlas = newAtlas;
+        }
+
+        const sf::Vector2u position{m_nextX, m_nextY};
+        m_nextX += width + 1;
+        m_rowHeight = std::max(m_rowHeight, height);
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
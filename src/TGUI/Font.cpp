@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Font.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +81,27 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::enableDistanceField(unsigned int referenceSize) const
+    {
+        DistanceFieldFont::enable(m_font, referenceSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::disableDistanceField() const
+    {
+        DistanceFieldFont::disable(m_font.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isDistanceFieldEnabled() const
+    {
+        return m_font && (DistanceFieldFont::get(m_font.get()) != nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
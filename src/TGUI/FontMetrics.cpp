@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/FontMetrics.hpp>
+
+#include <cmath>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<const sf::Font*, FontMetrics::Entry> FontMetrics::m_fontMetrics;
+    FontMetrics::Entry* FontMetrics::m_lastUsedEntry = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontMetrics::FontMetrics(const sf::Font& font) :
+        m_font{&font}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FontMetrics::getLineSpacing(unsigned int characterSize)
+    {
+        if ((characterSize == 0) || (characterSize > maxCachedSize))
+            return m_font->getLineSpacing(characterSize);
+
+        if (m_lineSpacing.size() < characterSize)
+            m_lineSpacing.resize(characterSize, -1);
+
+        float& lineSpacing = m_lineSpacing[characterSize - 1];
+        if (lineSpacing < 0)
+            lineSpacing = m_font->getLineSpacing(characterSize);
+
+        return lineSpacing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FontMetrics::getVerticalCorrection(unsigned int characterSize, bool bold)
+    {
+        // The line spacing returned by sfml is correct but there is extra space on top.
+        // The height of the first line is the character size (everything above the baseline) plus the part below the baseline.
+        const auto calculate = [this,characterSize,bold]{
+            const sf::FloatRect& bounds = m_font->getGlyph('g', characterSize, bold).bounds;
+            return characterSize + bounds.height + bounds.top - getLineSpacing(characterSize);
+        };
+
+        if ((characterSize == 0) || (characterSize > maxCachedSize))
+            return calculate();
+
+        std::vector<float>& table = m_verticalCorrection[bold ? 1 : 0];
+        if (table.size() < characterSize)
+            table.resize(characterSize, std::numeric_limits<float>::quiet_NaN());
+
+        // The correction can be negative, so NaN marks the values that weren't calculated yet
+        float& correction = table[characterSize - 1];
+        if (std::isnan(correction))
+            correction = calculate();
+
+        return correction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int FontMetrics::findBestTextSize(float height, int fit)
+    {
+        if (height < 2)
+            return 1;
+
+        // Find the smallest character size of which the line spacing isn't smaller than the height
+        const unsigned int maxSize = static_cast<unsigned int>(height);
+        unsigned int high = 1;
+        unsigned int count = maxSize;
+        while (count > 0)
+        {
+            const unsigned int step = count / 2;
+            if (getLineSpacing(high + step) < height)
+            {
+                high += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
+
+        if (high > maxSize)
+            return maxSize;
+
+        const float highLineSpacing = getLineSpacing(high);
+        if ((highLineSpacing == height) || (high == 1))
+            return high;
+
+        const unsigned int low = high - 1;
+        const float lowLineSpacing = getLineSpacing(low);
+
+        if (fit < 0)
+            return low;
+        else if (fit > 0)
+            return high;
+        else
+        {
+            if (std::abs(height - lowLineSpacing) < std::abs(height - highLineSpacing))
+                return low;
+            else
+                return high;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontMetrics& FontMetrics::get(const std::shared_ptr<sf::Font>& font)
+    {
+        // Widgets usually ask for the same font many times in a row
+        if (m_lastUsedEntry && (m_lastUsedEntry->metrics->m_font == font.get()) && !m_lastUsedEntry->font.expired())
+            return *m_lastUsedEntry->metrics;
+
+        Entry& entry = m_fontMetrics[font.get()];
+
+        // A different font could have been created at the address of a font that no longer exists
+        if (!entry.metrics || entry.font.expired())
+        {
+            entry.font = font;
+            entry.metrics = std::unique_ptr<FontMetrics>(new FontMetrics(*font));
+        }
+
+        m_lastUsedEntry = &entry;
+        return *entry.metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontMetrics::clear()
+    {
+        m_fontMetrics.clear();
+        m_lastUsedEntry = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,12 +25,311 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/FontMetrics.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
 #include <functional>
+#include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <limits>
+#include <iomanip>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool isSpace(char c)
+    {
+        return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Returns value * 10^exponent. The result is correctly rounded when the exponent lies between -22 and 22,
+    // because all these powers of ten can be represented exactly by a double.
+    double scaleByPowerOfTen(double result, int exponent)
+    {
+        static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        if (result == 0)
+            return 0;
+
+        while (exponent > 22)
+        {
+            result *= powers[22];
+            exponent -= 22;
+        }
+        while (exponent < -22)
+        {
+            result /= powers[22];
+            exponent += 22;
+        }
+
+        if (exponent >= 0)
+            return result * powers[exponent];
+        else
+            return result / powers[-exponent];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double composeNumber(unsigned long long mantissa, int exponent)
+    {
+        return scaleByPowerOfTen(static_cast<double>(mantissa), exponent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t formatInteger(char* buffer, unsigned long long value, bool negative)
+    {
+        char digits[24];
+        std::size_t digitCount = 0;
+        do
+        {
+            digits[digitCount++] = static_cast<char>('0' + (value % 10));
+            value /= 10;
+        }
+        while (value > 0);
+
+        std::size_t length = 0;
+        if (negative)
+            buffer[length++] = '-';
+
+        while (digitCount > 0)
+            buffer[length++] = digits[--digitCount];
+
+        return length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Writes the number with the least amount of significant digits for which converting back to T gives the same value
+    template <typename T>
+    std::size_t formatFloatingPoint(char* buffer, T value, int maxDigits)
+    {
+        std::size_t length = 0;
+        if (std::isnan(value))
+        {
+            buffer[0] = 'n'; buffer[1] = 'a'; buffer[2] = 'n';
+            return 3;
+        }
+
+        if (std::signbit(value))
+        {
+            buffer[length++] = '-';
+            value = -value;
+        }
+
+        if (std::isinf(value))
+        {
+            buffer[length++] = 'i'; buffer[length++] = 'n'; buffer[length++] = 'f';
+            return length;
+        }
+
+        if (value == 0)
+        {
+            buffer[length++] = '0';
+            return length;
+        }
+
+        // Find the exponent of the first significant digit
+        int exponent = static_cast<int>(std::floor(std::log10(static_cast<double>(value))));
+        if (composeNumber(1, exponent) > value)
+            --exponent;
+        else if (composeNumber(1, exponent + 1) <= value)
+            ++exponent;
+
+        // Try more and more digits until the value can be read back correctly.
+        // The trailing zeros are removed from the mantissa, just like parseNumber does before composing the number.
+        unsigned long long mantissa = 0;
+        int mantissaExponent = 0;
+        bool found = false;
+        for (int digits = 1; (digits <= maxDigits) && !found; ++digits)
+        {
+            mantissaExponent = exponent - digits + 1;
+            mantissa = static_cast<unsigned long long>(std::llround(scaleByPowerOfTen(static_cast<double>(value), -mantissaExponent)));
+
+            while ((mantissa % 10 == 0) && (mantissa > 0))
+            {
+                mantissa /= 10;
+                ++mantissaExponent;
+            }
+
+            // Doubles can only be checked when composing the number is correctly rounded, floats have enough precision left
+            if (std::is_same<T, double>::value
+             && ((mantissaExponent < -22) || (mantissaExponent > 22) || (mantissa > (1ULL << 53))))
+                continue;
+
+            found = (static_cast<T>(composeNumber(mantissa, mantissaExponent)) == value);
+        }
+
+        // Scaling by large powers of ten isn't exact, so some very large or very small doubles can't be found in this way.
+        // The standard library is used for these rare numbers, with the classic locale to still get a dot as decimal point.
+        if (!found)
+        {
+            std::ostringstream oss;
+            oss.imbue(std::locale::classic());
+            oss << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+
+            const std::string str = oss.str();
+            std::copy(str.begin(), str.end(), buffer + length);
+            return length + str.size();
+        }
+
+        char digits[24];
+        int digitCount = 0;
+        for (unsigned long long m = mantissa; m > 0; m /= 10)
+            digits[digitCount++] = static_cast<char>('0' + (m % 10));
+
+        // The position of the first digit might have changed when rounding (e.g. 9.99 became 10)
+        exponent = mantissaExponent + digitCount - 1;
+
+        if ((exponent >= -25) && (exponent < 40))
+        {
+            // Write the number without an exponent, so that it can also be used inside layout strings
+            if (exponent < 0)
+            {
+                buffer[length++] = '0';
+                buffer[length++] = '.';
+                for (int i = -1; i > exponent; --i)
+                    buffer[length++] = '0';
+            }
+
+            for (int i = 0; i < digitCount; ++i)
+            {
+                if ((i > 0) && (i == exponent + 1))
+                    buffer[length++] = '.';
+
+                buffer[length++] = digits[digitCount - 1 - i];
+            }
+
+            for (int i = digitCount; i <= exponent; ++i)
+                buffer[length++] = '0';
+        }
+        else // The number is too large or too small, use the scientific notation
+        {
+            for (int i = 0; i < digitCount; ++i)
+            {
+                if (i == 1)
+                    buffer[length++] = '.';
+
+                buffer[length++] = digits[digitCount - 1 - i];
+            }
+
+            buffer[length++] = 'e';
+            buffer[length++] = (exponent < 0) ? '-' : '+';
+            length += formatInteger(buffer + length, static_cast<unsigned long long>(std::abs(exponent)), false);
+        }
+
+        return length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Reads the optional sign and the digits of a number, returns false when there are no digits
+    bool parseDigits(const char*& c, const char* end, bool allowFraction, bool& negative,
+                     unsigned long long& mantissa, int& exponent, bool& overflow)
+    {
+        negative = false;
+        mantissa = 0;
+        exponent = 0;
+        overflow = false;
+
+        while ((c != end) && isSpace(*c))
+            ++c;
+
+        if ((c != end) && ((*c == '-') || (*c == '+')))
+        {
+            negative = (*c == '-');
+            ++c;
+        }
+
+        bool digitFound = false;
+        int significantDigits = 0;
+        while ((c != end) && (*c >= '0') && (*c <= '9'))
+        {
+            digitFound = true;
+            if (significantDigits < 19)
+            {
+                mantissa = mantissa * 10 + static_cast<unsigned long long>(*c - '0');
+                if (mantissa > 0)
+                    ++significantDigits;
+            }
+            else // Digits that no longer fit in the mantissa only change the exponent
+            {
+                ++exponent;
+                overflow = true;
+            }
+            ++c;
+        }
+
+        if (!allowFraction)
+            return digitFound;
+
+        if ((c != end) && (*c == '.'))
+        {
+            ++c;
+            while ((c != end) && (*c >= '0') && (*c <= '9'))
+            {
+                digitFound = true;
+                if (significantDigits < 19)
+                {
+                    mantissa = mantissa * 10 + static_cast<unsigned long long>(*c - '0');
+                    --exponent;
+                    if (mantissa > 0)
+                        ++significantDigits;
+                }
+                ++c;
+            }
+        }
+
+        if (!digitFound)
+            return false;
+
+        // The exponent is only part of the number when there are digits behind the 'e'
+        if ((c != end) && ((*c == 'e') || (*c == 'E')))
+        {
+            const char* exponentStart = c++;
+            bool negativeExponent = false;
+            if ((c != end) && ((*c == '-') || (*c == '+')))
+            {
+                negativeExponent = (*c == '-');
+                ++c;
+            }
+
+            if ((c != end) && (*c >= '0') && (*c <= '9'))
+            {
+                int explicitExponent = 0;
+                while ((c != end) && (*c >= '0') && (*c <= '9'))
+                {
+                    if (explicitExponent < 100000)
+                        explicitExponent = explicitExponent * 10 + (*c - '0');
+                    ++c;
+                }
+
+                exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            }
+            else
+                c = exponentStart;
+        }
+
+        // Remove the trailing zeros, so that the same number is always composed in the same way
+        while ((mantissa % 10 == 0) && (mantissa > 0))
+        {
+            mantissa /= 10;
+            ++exponent;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -95,15 +394,80 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    int stoi(const std::string& value)
+    std::size_t formatNumber(char* buffer, long long value)
     {
-        int result = 0;
+        if (value < 0)
+            return formatInteger(buffer, 0 - static_cast<unsigned long long>(value), true);
+        else
+            return formatInteger(buffer, static_cast<unsigned long long>(value), false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t formatNumber(char* buffer, unsigned long long value)
+    {
+        return formatInteger(buffer, value, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t formatNumber(char* buffer, float value)
+    {
+        return formatFloatingPoint(buffer, value, 9);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t formatNumber(char* buffer, double value)
+    {
+        return formatFloatingPoint(buffer, value, 17);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool parseNumber(const char* begin, const char* end, int& value)
+    {
+        bool negative;
+        unsigned long long mantissa;
+        int exponent;
+        bool overflow;
+        if (!parseDigits(begin, end, false, negative, mantissa, exponent, overflow) || overflow)
+            return false;
+
+        const unsigned long long limit = negative ? static_cast<unsigned long long>(std::numeric_limits<int>::max()) + 1
+                                                  : static_cast<unsigned long long>(std::numeric_limits<int>::max());
+        if (mantissa > limit)
+            return false;
+
+        value = negative ? static_cast<int>(0 - mantissa) : static_cast<int>(mantissa);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool parseNumber(const char* begin, const char* end, float& value)
+    {
+        bool negative;
+        unsigned long long mantissa;
+        int exponent;
+        bool overflow;
+        if (!parseDigits(begin, end, true, negative, mantissa, exponent, overflow))
+            return false;
+
+        const float result = static_cast<float>(composeNumber(mantissa, exponent));
+        if (std::isinf(result))
+            return false;
+
+        value = negative ? -result : result;
+        return true;
+    }
 
-        std::istringstream iss(value);
-        iss.imbue(std::locale::classic());
-        iss >> result;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (iss.fail())
+    int stoi(const std::string& value)
+    {
+        int result = 0;
+        if (!parseNumber(value.data(), value.data() + value.size(), result))
             result = 0;
 
         return result;
@@ -114,12 +478,7 @@ namespace tgui
     float stof(const std::string& value)
     {
         float result = 0;
-
-        std::istringstream iss(value);
-        iss.imbue(std::locale::classic());
-        iss >> result;
-
-        if (iss.fail())
+        if (!parseNumber(value.data(), value.data() + value.size(), result))
             result = 0;
 
         return result;
@@ -166,8 +525,17 @@ namespace tgui
 
     std::string trim(std::string str)
     {
-        str.erase(str.begin(), std::find_if(str.begin(), str.end(), std::not1(std::ptr_fun<int, int>(std::isspace))));
-        str.erase(std::find_if(str.rbegin(), str.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), str.end());
+        std::size_t last = str.size();
+        while ((last > 0) && isSpace(str[last - 1]))
+            --last;
+
+        std::size_t first = 0;
+        while ((first < last) && isSpace(str[first]))
+            ++first;
+
+        // Erasing the end first avoids moving the characters that are going to be removed anyway
+        str.erase(last);
+        str.erase(0, first);
         return str;
     }
 
@@ -176,6 +544,7 @@ namespace tgui
     std::vector<std::string> split(const std::string& str, char delim)
     {
         std::vector<std::string> tokens;
+        tokens.reserve(std::count(str.begin(), str.end(), delim) + 1);
 
         std::size_t start = 0;
         std::size_t end = 0;
@@ -205,18 +574,7 @@ namespace tgui
         if (!font)
             return 0;
 
-        bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        float lineHeight = characterSize
-                           + font->getGlyph('g', characterSize, bold).bounds.height
-                           + font->getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        float lineSpacing = font->getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        return FontMetrics::get(font).getVerticalCorrection(characterSize, (style & sf::Text::Bold) != 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,35 +584,7 @@ namespace tgui
         if (!font)
             return 0;
 
-        if (height < 2)
-            return 1;
-
-        std::vector<unsigned int> textSizes(static_cast<std::size_t>(height));
-        for (unsigned int i = 0; i < static_cast<unsigned int>(height); ++i)
-            textSizes[i] = i + 1;
-
-        auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height, [&font](unsigned int charSize, float h){ return font->getLineSpacing(charSize) < h; });
-        if (high == textSizes.end())
-            return static_cast<unsigned int>(height);
-
-        float highLineSpacing = font->getLineSpacing(*high);
-        if (highLineSpacing == height)
-            return *high;
-
-        auto low = high - 1;
-        float lowLineSpacing = font->getLineSpacing(*low);
-
-        if (fit < 0)
-            return *low;
-        else if (fit > 0)
-            return *high;
-        else
-        {
-            if (std::abs(height - lowLineSpacing) < std::abs(height - highLineSpacing))
-                return *low;
-            else
-                return *high;
-        }
+        return FontMetrics::get(font).findBestTextSize(height, fit);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
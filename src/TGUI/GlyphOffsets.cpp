@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/GlyphOffsets.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    GlyphOffsets::GlyphOffsets() :
+        m_offsets(1, 0.f)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphOffsets::setText(const sf::String& text, const sf::Font& font, unsigned int characterSize, bool bold)
+    {
+        update(text, 0, font, characterSize, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphOffsets::update(const sf::String& text, std::size_t firstChangedCharacter, const sf::Font& font, unsigned int characterSize, bool bold)
+    {
+        // The offset of the first changed character only depends on the characters in front of it
+        firstChangedCharacter = std::min(firstChangedCharacter, text.getSize());
+        truncate(firstChangedCharacter);
+
+        // Calculate the positions in the same way as sf::Text does
+        const float whitespaceWidth = static_cast<float>(font.getGlyph(' ', characterSize, bold).advance);
+
+        float x = m_offsets.back();
+        sf::Uint32 prevChar = (m_offsets.size() > 1) ? text[m_offsets.size() - 2] : 0;
+        for (std::size_t i = m_offsets.size() - 1; i < text.getSize(); ++i)
+        {
+            const sf::Uint32 curChar = text[i];
+            x += static_cast<float>(font.getKerning(prevChar, curChar, characterSize));
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar != '\n')
+                x += static_cast<float>(font.getGlyph(curChar, characterSize, bold).advance);
+
+            m_offsets.push_back(x);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphOffsets::truncate(std::size_t characterCount)
+    {
+        if (characterCount + 1 < m_offsets.size())
+            m_offsets.resize(characterCount + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphOffsets::addCharacter(float offsetBehindCharacter)
+    {
+        m_offsets.push_back(offsetBehindCharacter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphOffsets::findCaretPosition(float x) const
+    {
+        // The middles of the characters are increasing, so the first character of which the middle lies on the right
+        // of the position can be found with a binary search
+        std::size_t low = 0;
+        std::size_t high = getCharacterCount();
+        while (low < high)
+        {
+            const std::size_t mid = low + (high - low) / 2;
+            if ((m_offsets[mid] + m_offsets[mid + 1]) / 2.f < x)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+
+        return low;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,9 +23,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/DefaultFont.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <SFML/OpenGL.hpp>
 
@@ -119,6 +121,7 @@ namespace tgui
             m_container->m_size = view.getSize();
             m_container->m_callback.size = m_container->getSize();
             m_container->sendSignal("SizeChanged", m_container->getSize());
+            m_container->invalidate();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -128,6 +131,7 @@ namespace tgui
 
     bool Gui::handleEvent(sf::Event event)
     {
+        TGUI_PROFILE_SCOPE("Gui", "handleEvent");
         assert(m_window != nullptr);
 
         // Check if the event has something to do with the mouse
@@ -216,6 +220,45 @@ namespace tgui
 
     void Gui::draw()
     {
+        drawImpl(false);
+        TGUI_PROFILE_END_FRAME();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw()
+    {
+        if (m_container->m_focused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+
+        return m_container->m_redrawNeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect Gui::getDirtyArea() const
+    {
+        if (m_container->m_redrawNeeded)
+            return m_container->m_dirtyArea;
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawDirtyArea()
+    {
+        drawImpl(true);
+        TGUI_PROFILE_END_FRAME();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawImpl(bool onlyDirtyArea)
+    {
+        TGUI_PROFILE_SCOPE("Gui", "draw");
         assert(m_window != nullptr);
 
         // Make sure the right opengl context is set when clipping
@@ -244,6 +287,7 @@ namespace tgui
             // Enable clipping
             glEnable(GL_SCISSOR_TEST);
             glScissor(0, 0, m_window->getSize().x, m_window->getSize().y);
+            TGUI_PROFILE_SCISSOR_CHANGE();
         }
 
         // Change the view
@@ -251,14 +295,31 @@ namespace tgui
         m_window->setView(m_view);
 
         // Draw the window with all widgets inside it
-        m_container->drawWidgetContainer(m_window, sf::RenderStates::Default);
+        if (onlyDirtyArea)
+        {
+            if (m_container->m_redrawNeeded)
+            {
+                const sf::FloatRect& area = m_container->m_dirtyArea;
+                Clipping clipping{*m_window, sf::RenderStates::Default, {area.left, area.top}, {area.width, area.height}};
+
+                m_container->drawWidgetContainer(m_window, sf::RenderStates::Default);
+            }
+        }
+        else
+            m_container->drawWidgetContainer(m_window, sf::RenderStates::Default);
+
+        m_container->m_redrawNeeded = false;
+        m_container->m_dirtyArea = {};
 
         // Restore the old view
         m_window->setView(oldView);
 
         // Reset clipping to its original state
         if (clippingEnabled)
+        {
             glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+            TGUI_PROFILE_SCISSOR_CHANGE();
+        }
         else
             glDisable(GL_SCISSOR_TEST);
     }
@@ -395,8 +456,11 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        TGUI_PROFILE_SCOPE("Gui", "updateTime");
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
+        m_tweener.update(elapsedTime);
 
         if (m_tooltipPossible)
         {
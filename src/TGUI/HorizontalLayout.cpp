@@ -16,7 +16,7 @@ namespace tgui
 
     HorizontalLayout::Ptr HorizontalLayout::create()
     {
-        return std::make_shared<HorizontalLayout>();
+        return makePooled<HorizontalLayout>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
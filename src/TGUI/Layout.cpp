@@ -25,6 +25,7 @@
 
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 #include <cctype>
@@ -136,6 +137,8 @@ namespace tgui
 
     void LayoutImpl::recalculate()
     {
+        TGUI_PROFILE_SCOPE("Layout", "recalculate");
+
         for (auto& operand : operands)
             operand->recalculate();
 
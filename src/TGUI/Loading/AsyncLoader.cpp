@@ -0,0 +1,340 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Loading/AsyncLoader.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/TextureManager.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Returns whether the value of a property with this name may be a texture
+        bool isTextureProperty(const std::string& lowercaseProperty)
+        {
+            return ((lowercaseProperty.size() >= 5) && (lowercaseProperty.compare(lowercaseProperty.size() - 5, 5, "image") == 0))
+                || ((lowercaseProperty.size() >= 7) && (lowercaseProperty.compare(lowercaseProperty.size() - 7, 7, "texture") == 0));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Theme loader that doesn't access the global resource path, which may be changed by the gui thread while loading
+        class PreloadThemeLoader : public DefaultThemeLoader
+        {
+        public:
+
+            explicit PreloadThemeLoader(const std::string& resourcePath) :
+                m_resourcePath(resourcePath)
+            {
+            }
+
+            // Returns the values of the properties in a cached theme file that may contain a texture
+            std::vector<std::string> getTextureValues(const std::string& filename) const
+            {
+                return getCachedPropertyValues(filename, isTextureProperty);
+            }
+
+        protected:
+
+            virtual void readFile(const std::string& filename, std::stringstream& contents) const override
+            {
+                std::ifstream file{m_resourcePath + filename};
+                if (!file.is_open())
+                    throw Exception{"Failed to open theme file '" + m_resourcePath + filename + "'."};
+
+                contents << file.rdbuf();
+            }
+
+        private:
+
+            std::string m_resourcePath;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the filename from a serialized texture, in the same way as the deserializer would do it
+        bool getTextureFilename(const std::string& value, std::string& filename)
+        {
+            auto c = value.begin();
+            while ((c != value.end()) && ((*c == ' ') || (*c == '\t') || (*c == '\r') || (*c == '\n')))
+                ++c;
+
+            if ((c == value.end()) || (*c != '"'))
+                return false;
+
+            ++c;
+            filename.clear();
+            char prev = '\0';
+            while (c != value.end())
+            {
+                if ((*c == '"') && (prev != '\\'))
+                    return !filename.empty();
+
+                prev = *c;
+                filename.push_back(*c);
+                ++c;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Collects the filenames of the images used by the pictures and renderers in a parsed widget file
+        void getWidgetFileImages(const std::shared_ptr<DataIO::Node>& node, const std::string& resourcePath, std::vector<std::string>& filenames)
+        {
+            std::string filename;
+            for (auto& child : node->children)
+            {
+                const std::string name = toLower(child->name);
+                if (name == "renderer")
+                {
+                    // Textures in renderers are relative to the resource path
+                    for (auto& pair : child->propertyValuePairs)
+                    {
+                        if (pair.second && isTextureProperty(toLower(pair.first)) && getTextureFilename(pair.second->value, filename))
+                            filenames.push_back(resourcePath + filename);
+                    }
+                }
+                else
+                {
+                    // The filename of a picture is passed to the texture unchanged
+                    if (name.compare(0, 7, "picture") == 0)
+                    {
+                        for (auto& pair : child->propertyValuePairs)
+                        {
+                            if (pair.second && (toLower(pair.first) == "filename") && getTextureFilename(pair.second->value, filename))
+                                filenames.push_back(filename);
+                        }
+                    }
+
+                    getWidgetFileImages(child, resourcePath, filenames);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AsyncLoader::AsyncLoader(unsigned int threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        m_threads.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i)
+            m_threads.emplace_back(&AsyncLoader::runWorker, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AsyncLoader::~AsyncLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stopping = true;
+        }
+
+        m_taskAdded.notify_all();
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> AsyncLoader::preloadTheme(const std::string& filename)
+    {
+        // Textures in the theme are relative to the folder of the theme file, like when the theme is used by Theme::initWidget
+        const std::string resourcePath = getResourcePath();
+        const auto slashPos = filename.find_last_of("/\\");
+        const std::string themePath = (slashPos != std::string::npos) ? resourcePath + filename.substr(0, slashPos + 1) : resourcePath;
+        const auto imageLoader = Texture::getImageLoader();
+        const std::string cacheDirectory = TextureManager::getImageCacheDirectory();
+
+        auto task = std::make_shared<std::packaged_task<void()>>([=]{
+            PreloadThemeLoader loader{resourcePath};
+            loader.preload(filename);
+
+            std::string imageFilename;
+            for (auto& value : loader.getTextureValues(filename))
+            {
+                if (getTextureFilename(value, imageFilename))
+                    decodeImage(themePath + imageFilename, imageLoader, cacheDirectory);
+            }
+        });
+
+        std::shared_future<void> future = task->get_future().share();
+        addTask([task]{ (*task)(); });
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<std::shared_ptr<DataIO::Node>> AsyncLoader::parseWidgetFile(const std::string& filename)
+    {
+        const std::string resourcePath = getResourcePath();
+        const auto imageLoader = Texture::getImageLoader();
+        const std::string cacheDirectory = TextureManager::getImageCacheDirectory();
+
+        auto task = std::make_shared<std::packaged_task<std::shared_ptr<DataIO::Node>()>>([=]{
+            std::ifstream in{filename};
+            if (!in.is_open())
+                throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+            std::stringstream stream;
+            stream << in.rdbuf();
+            auto rootNode = DataIO::parse(stream);
+
+            std::vector<std::string> imageFilenames;
+            getWidgetFileImages(rootNode, resourcePath, imageFilenames);
+            for (auto& imageFilename : imageFilenames)
+                decodeImage(imageFilename, imageLoader, cacheDirectory);
+
+            return rootNode;
+        });
+
+        std::shared_future<std::shared_ptr<DataIO::Node>> future = task->get_future().share();
+        addTask([task]{ (*task)(); });
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> AsyncLoader::preloadImage(const std::string& filename)
+    {
+        const std::string fullFilename = getResourcePath() + filename;
+        const auto imageLoader = Texture::getImageLoader();
+        const std::string cacheDirectory = TextureManager::getImageCacheDirectory();
+
+        auto task = std::make_shared<std::packaged_task<void()>>([=]{
+            decodeImage(fullFilename, imageLoader, cacheDirectory);
+        });
+
+        std::shared_future<void> future = task->get_future().share();
+        addTask([task]{ (*task)(); });
+        return future;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int AsyncLoader::getThreadCount() const
+    {
+        return static_cast<unsigned int>(m_threads.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AsyncLoader::addTask(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_tasks.push_back(std::move(task));
+        }
+
+        m_taskAdded.notify_one();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AsyncLoader::runWorker()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_taskAdded.wait(lock, [this]{ return m_stopping || !m_tasks.empty(); });
+
+                // The remaining tasks are still executed when stopping, their futures would otherwise never become ready
+                if (m_tasks.empty())
+                    return;
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            // Exceptions are stored in the future by the packaged task
+            task();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AsyncLoader::decodeImage(const std::string& filename, const Texture::ImageLoaderFunc& imageLoader, const std::string& cacheDirectory)
+    {
+        // Several files may use the same image, it only has to be decoded once.
+        // When another thread is already decoding it then we wait for it, so that the image exists when our future is ready.
+        std::promise<void> decoded;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            auto decodingIt = m_imagesBeingDecoded.find(filename);
+            if (decodingIt != m_imagesBeingDecoded.end())
+            {
+                std::shared_future<void> otherDecode = decodingIt->second;
+                lock.unlock();
+                otherDecode.wait();
+                return;
+            }
+
+            m_imagesBeingDecoded[filename] = decoded.get_future().share();
+        }
+
+        const auto finishDecoding = [&]{
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_imagesBeingDecoded.erase(filename);
+            }
+            decoded.set_value();
+        };
+
+        std::shared_ptr<sf::Image> image;
+        try
+        {
+            // When decoding fails, the texture manager will try again and report the error on the gui thread
+            if (!TextureManager::hasPreloadedImage(filename))
+                image = TextureManager::loadImage(filename, imageLoader, cacheDirectory);
+        }
+        catch (...)
+        {
+            finishDecoding();
+            throw;
+        }
+
+        if (image)
+            TextureManager::addPreloadedImage(filename, std::move(image));
+
+        finishDecoding();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
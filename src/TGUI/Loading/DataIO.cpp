@@ -30,6 +30,14 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // The emitted text is written to the stream each time this many bytes have been collected
+    const std::size_t emitBufferSize = 64 * 1024;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,61 +135,89 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(std::shared_ptr<Node> rootNode, std::stringstream& stream)
+    void DataIO::emit(std::shared_ptr<Node> rootNode, std::ostream& stream)
     {
+        std::string buffer;
+        buffer.reserve(emitBufferSize);
+
         for (auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << ": " << pair.second->value << ";" << std::endl;
+        {
+            buffer += pair.first;
+            buffer += ": ";
+            buffer += pair.second->value;
+            buffer += ";\n";
+        }
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+            buffer += '\n';
 
-        std::vector<std::string> output;
         for (std::size_t i = 0; i < rootNode->children.size(); ++i)
         {
-            for (auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            emitNode(*rootNode->children[i], 0, buffer, stream);
 
             if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+                buffer += '\n';
         }
 
-        for (auto& line : output)
-            stream << line << std::endl;
+        flushBuffer(buffer, stream, true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<std::string> DataIO::convertNodesToLines(std::shared_ptr<Node> node)
+    void DataIO::emitNode(const Node& node, std::size_t depth, std::string& buffer, std::ostream& stream)
     {
-        std::vector<std::string> output;
-        if (node->name.empty())
-            output.emplace_back("{");
-        else
-            output.emplace_back(node->name + " {");
+        // Every nesting level is indented with 4 spaces, including the empty lines between the properties and sections
+        const std::size_t indentation = 4 * depth;
 
-        if (node->propertyValuePairs.size())
+        buffer.append(indentation, ' ');
+        if (!node.name.empty())
         {
-            for (auto& pair : node->propertyValuePairs)
-                output.emplace_back("    " + pair.first + ": " + pair.second->value + ";");
+            buffer += node.name;
+            buffer += ' ';
         }
+        buffer += "{\n";
 
-        if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-            output.emplace_back("");
+        for (auto& pair : node.propertyValuePairs)
+        {
+            buffer.append(indentation + 4, ' ');
+            buffer += pair.first;
+            buffer += ": ";
+            buffer += pair.second->value;
+            buffer += ";\n";
+        }
 
-        if (node->children.size())
+        if (node.propertyValuePairs.size() > 0 && node.children.size() > 0)
         {
-            for (std::size_t i = 0; i < node->children.size(); ++i)
-            {
-                for (auto& line : convertNodesToLines(node->children[i]))
-                    output.emplace_back("    " + line);
+            buffer.append(indentation, ' ');
+            buffer += '\n';
+        }
+
+        for (std::size_t i = 0; i < node.children.size(); ++i)
+        {
+            emitNode(*node.children[i], depth + 1, buffer, stream);
 
-                if (i < node->children.size() - 1)
-                    output.emplace_back("");
+            if (i < node.children.size() - 1)
+            {
+                buffer.append(indentation, ' ');
+                buffer += '\n';
             }
         }
 
-        output.emplace_back("}");
-        return output;
+        buffer.append(indentation, ' ');
+        buffer += "}\n";
+
+        flushBuffer(buffer, stream, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::flushBuffer(std::string& buffer, std::ostream& stream, bool force)
+    {
+        if (force || (buffer.size() >= emitBufferSize))
+        {
+            stream.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
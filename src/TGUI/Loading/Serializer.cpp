@@ -115,27 +115,28 @@ namespace tgui
 
     TGUI_API std::string serializeString(ObjectConverter&& value)
     {
-        std::string result = value.getString();
+        const std::string str = value.getString();
 
-        auto replace = [&](char from, char to)
+        // Escape the special characters in a single pass over the string
+        std::string result;
+        result.reserve(str.size() + 2);
+        result += '"';
+        for (const char c : str)
+        {
+            switch (c)
             {
-                std::size_t pos = 0;
-                while ((pos = result.find(from, pos)) != std::string::npos)
-                {
-                    result[pos] = to;
-                    result.insert(pos, 1, '\\');
-                    pos += 2;
-                }
-            };
-
-        replace('\\', '\\');
-        replace('\"', '\"');
-        replace('\v', 'v');
-        replace('\t', 't');
-        replace('\n', 'n');
-        replace('\0', '0');
-
-        return "\"" + result + "\"";
+                case '\\': result += "\\\\"; break;
+                case '\"': result += "\\\""; break;
+                case '\v': result += "\\v"; break;
+                case '\t': result += "\\t"; break;
+                case '\n': result += "\\n"; break;
+                case '\0': result += "\\0"; break;
+                default: result += c; break;
+            }
+        }
+        result += '"';
+
+        return result;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
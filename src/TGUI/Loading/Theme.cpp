@@ -53,25 +53,25 @@ namespace tgui
 
     std::map<std::string, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
         {
-            {"button", std::make_shared<Button>},
-            {"chatbox", std::make_shared<ChatBox>},
-            {"checkbox", std::make_shared<CheckBox>},
-            {"childwindow", std::make_shared<ChildWindow>},
-            {"combobox", std::make_shared<ComboBox>},
-            {"editbox", std::make_shared<EditBox>},
-            {"knob", std::make_shared<Knob>},
-            {"label", std::make_shared<Label>},
-            {"listbox", std::make_shared<ListBox>},
-            {"menubar", std::make_shared<MenuBar>},
-            {"messagebox", std::make_shared<MessageBox>},
-            {"panel", std::make_shared<Panel>},
-            {"progressbar", std::make_shared<ProgressBar>},
-            {"radiobutton", std::make_shared<RadioButton>},
-            {"scrollbar", std::make_shared<Scrollbar>},
-            {"slider", std::make_shared<Slider>},
-            {"spinbutton", std::make_shared<SpinButton>},
-            {"tab", std::make_shared<Tab>},
-            {"textbox", std::make_shared<TextBox>}
+            {"button", makePooled<Button>},
+            {"chatbox", makePooled<ChatBox>},
+            {"checkbox", makePooled<CheckBox>},
+            {"childwindow", makePooled<ChildWindow>},
+            {"combobox", makePooled<ComboBox>},
+            {"editbox", makePooled<EditBox>},
+            {"knob", makePooled<Knob>},
+            {"label", makePooled<Label>},
+            {"listbox", makePooled<ListBox>},
+            {"menubar", makePooled<MenuBar>},
+            {"messagebox", makePooled<MessageBox>},
+            {"panel", makePooled<Panel>},
+            {"progressbar", makePooled<ProgressBar>},
+            {"radiobutton", makePooled<RadioButton>},
+            {"scrollbar", makePooled<Scrollbar>},
+            {"slider", makePooled<Slider>},
+            {"spinbutton", makePooled<SpinButton>},
+            {"tab", makePooled<Tab>},
+            {"textbox", makePooled<TextBox>}
         };
 
     std::shared_ptr<BaseThemeLoader> BaseTheme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
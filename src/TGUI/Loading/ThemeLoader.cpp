@@ -57,11 +57,13 @@ namespace tgui
 
     std::map<std::string, std::map<std::string, DefaultThemeLoader::PropertyValuePairs>> DefaultThemeLoader::m_propertiesCache;
     std::map<std::string, std::map<std::string, std::string>> DefaultThemeLoader::m_widgetTypeCache;
+    std::mutex DefaultThemeLoader::m_cacheMutex;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        std::lock_guard<std::mutex> lock{m_cacheMutex};
         if (filename != "")
         {
             auto propertiesCacheIt = m_propertiesCache.find(filename);
@@ -86,54 +88,101 @@ namespace tgui
         std::string lowercaseClassName = toLower(className);
 
         // The file may be cached
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        preload(filename);
+
+        std::lock_guard<std::mutex> lock{m_cacheMutex};
+
+        // The class name should be in the cache now
+        auto& fileProperties = m_propertiesCache[filename];
+        auto classIt = fileProperties.find(lowercaseClassName);
+        if (classIt == fileProperties.end())
+            throw Exception{"No class '" + className + "' was found in " + filename + "."};
+
+        // Copy the properties that were not already set
+        for (auto& pair : classIt->second)
         {
-            std::stringstream fileContents;
-            readFile(filename, fileContents);
+            if (propertyValuePair.find(pair.first) == propertyValuePair.end())
+                propertyValuePair[pair.first] = pair.second;
+        }
+
+        return m_widgetTypeCache[filename][lowercaseClassName];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::preload(const std::string& filename)
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_cacheMutex};
+            if (m_propertiesCache.find(filename) != m_propertiesCache.end())
+                return;
+        }
+
+        // The file is parsed without holding the lock, so that multiple files can be parsed at the same time
+        std::stringstream fileContents;
+        readFile(filename, fileContents);
 
-            std::shared_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+        std::shared_ptr<DataIO::Node> root = DataIO::parse(fileContents);
 
-            if (root->propertyValuePairs.size() != 0)
-                throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
+        if (root->propertyValuePairs.size() != 0)
+            throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
 
-            for (auto& child : root->children)
+        std::map<std::string, PropertyValuePairs> properties;
+        std::map<std::string, std::string> widgetTypes;
+        for (auto& child : root->children)
+        {
+            if (child->children.size() != 0)
+                throw Exception{"Unexpected result while loading theme file '" + filename + "'. Nested section encountered."};
+
+            auto pos = child->name.find('.');
+            std::string parsedClassName;
+            std::string widgetType = toLower(child->name.substr(0, pos));
+            if (pos != std::string::npos)
             {
-                if (child->children.size() != 0)
-                    throw Exception{"Unexpected result while loading theme file '" + filename + "'. Nested section encountered."};
-
-                auto pos = child->name.find('.');
-                std::string parsedClassName;
-                std::string widgetType = toLower(child->name.substr(0, pos));
-                if (pos != std::string::npos)
-                {
-                    if ((child->name.size() >= pos + 2) && (child->name[pos+1] == '"') && (child->name.back() == '"'))
-                        parsedClassName = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name.substr(pos + 1)).getString());
-                    else
-                        parsedClassName = toLower(child->name.substr(pos + 1));
-                }
+                if ((child->name.size() >= pos + 2) && (child->name[pos+1] == '"') && (child->name.back() == '"'))
+                    parsedClassName = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name.substr(pos + 1)).getString());
                 else
-                    parsedClassName = widgetType;
+                    parsedClassName = toLower(child->name.substr(pos + 1));
+            }
+            else
+                parsedClassName = widgetType;
 
-                for (auto& pair : child->propertyValuePairs)
-                {
-                    m_propertiesCache[filename][parsedClassName][toLower(pair.first)] = pair.second->value;
-                    m_widgetTypeCache[filename][parsedClassName] = widgetType;
-                }
+            for (auto& pair : child->propertyValuePairs)
+            {
+                properties[parsedClassName][toLower(pair.first)] = pair.second->value;
+                widgetTypes[parsedClassName] = widgetType;
             }
         }
 
-        // The class name should be in the cache now
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
-            throw Exception{"No class '" + className + "' was found in " + filename + "."};
+        // When another thread parsed the same file in the meantime then its result is kept
+        std::lock_guard<std::mutex> lock{m_cacheMutex};
+        m_propertiesCache.insert({filename, std::move(properties)});
+        m_widgetTypeCache.insert({filename, std::move(widgetTypes)});
+    }
 
-        // Copy the properties that were not already set
-        for (auto& pair : m_propertiesCache[filename][lowercaseClassName])
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> DefaultThemeLoader::getCachedPropertyValues(const std::string& filename,
+                                                                         const std::function<bool(const std::string&)>& propertyFilter)
+    {
+        std::vector<std::string> values;
+
+        std::lock_guard<std::mutex> lock{m_cacheMutex};
+        auto fileIt = m_propertiesCache.find(filename);
+        if (fileIt == m_propertiesCache.end())
+            return values;
+
+        for (auto& classPair : fileIt->second)
         {
-            if (propertyValuePair.find(pair.first) == propertyValuePair.end())
-                propertyValuePair[pair.first] = pair.second;
+            for (auto& pair : classPair.second)
+            {
+                // The property names in the cache are already lowercase
+                if (propertyFilter(pair.first))
+                    values.push_back(pair.second);
+            }
         }
 
-        return m_widgetTypeCache[filename][lowercaseClassName];
+        return values;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
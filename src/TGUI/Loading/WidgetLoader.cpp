@@ -38,11 +38,13 @@
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/Slider.hpp>
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tab.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Widgets/ThreadedCanvas.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -216,7 +218,7 @@ namespace tgui
         if (widget)
             button = std::static_pointer_cast<Button>(widget);
         else
-            button = std::make_shared<Button>();
+            button = makePooled<Button>();
 
         loadWidget(node, button);
         if (node->propertyValuePairs["text"])
@@ -234,7 +236,7 @@ namespace tgui
         if (widget)
             return loadWidget(node, widget);
         else
-            return loadWidget(node, std::make_shared<Canvas>());
+            return loadWidget(node, makePooled<Canvas>());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -245,7 +247,7 @@ namespace tgui
         if (widget)
             chatBox = std::static_pointer_cast<ChatBox>(widget);
         else
-            chatBox = std::make_shared<ChatBox>();
+            chatBox = makePooled<ChatBox>();
 
         loadWidget(node, chatBox);
 
@@ -303,7 +305,7 @@ namespace tgui
         if (widget)
             checkbox = std::static_pointer_cast<CheckBox>(widget);
         else
-            checkbox = std::make_shared<CheckBox>();
+            checkbox = makePooled<CheckBox>();
 
         loadWidget(node, checkbox);
         if (node->propertyValuePairs["text"])
@@ -327,7 +329,7 @@ namespace tgui
         if (widget)
             childWindow = std::static_pointer_cast<ChildWindow>(widget);
         else
-            childWindow = std::make_shared<ChildWindow>();
+            childWindow = makePooled<ChildWindow>();
 
         if (node->propertyValuePairs["titlealignment"])
         {
@@ -369,7 +371,7 @@ namespace tgui
         if (widget)
             return loadWidget(node, widget);
         else
-            return loadWidget(node, std::make_shared<ClickableWidget>());
+            return loadWidget(node, makePooled<ClickableWidget>());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,7 +382,7 @@ namespace tgui
         if (widget)
             comboBox = std::static_pointer_cast<ComboBox>(widget);
         else
-            comboBox = std::make_shared<ComboBox>();
+            comboBox = makePooled<ComboBox>();
 
         for (auto& childNode : node->children)
         {
@@ -405,7 +407,7 @@ namespace tgui
         if (widget)
             editBox = std::static_pointer_cast<EditBox>(widget);
         else
-            editBox = std::make_shared<EditBox>();
+            editBox = makePooled<EditBox>();
 
         loadWidget(node, editBox);
 
@@ -461,7 +463,7 @@ namespace tgui
         if (widget)
             knob = std::static_pointer_cast<Knob>(widget);
         else
-            knob = std::make_shared<Knob>();
+            knob = makePooled<Knob>();
 
         loadWidget(node, knob);
         if (node->propertyValuePairs["startrotation"])
@@ -488,7 +490,7 @@ namespace tgui
         if (widget)
             label = std::static_pointer_cast<Label>(widget);
         else
-            label = std::make_shared<Label>();
+            label = makePooled<Label>();
 
         loadWidget(node, label);
 
@@ -556,7 +558,7 @@ namespace tgui
         if (widget)
             listBox = std::static_pointer_cast<ListBox>(widget);
         else
-            listBox = std::make_shared<ListBox>();
+            listBox = makePooled<ListBox>();
 
         loadWidget(node, listBox);
 
@@ -619,7 +621,7 @@ namespace tgui
         if (widget)
             return loadContainer(node, std::static_pointer_cast<Panel>(widget));
         else
-            return loadContainer(node, std::make_shared<Panel>());
+            return loadContainer(node, makePooled<Panel>());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,10 +632,10 @@ namespace tgui
         if (widget)
             picture = std::static_pointer_cast<Picture>(widget);
         else
-            picture = std::make_shared<Picture>();
+            picture = makePooled<Picture>();
 
         if (node->propertyValuePairs["filename"])
-            picture = std::make_shared<Picture>(DESERIALIZE_STRING("filename"));
+            picture = makePooled<Picture>(DESERIALIZE_STRING("filename"));
 
         loadWidget(node, picture);
 
@@ -651,7 +653,7 @@ namespace tgui
         if (widget)
             progressBar = std::static_pointer_cast<ProgressBar>(widget);
         else
-            progressBar = std::make_shared<ProgressBar>();
+            progressBar = makePooled<ProgressBar>();
 
         loadWidget(node, progressBar);
         if (node->propertyValuePairs["minimum"])
@@ -691,7 +693,7 @@ namespace tgui
         if (widget)
             radioButton = std::static_pointer_cast<RadioButton>(widget);
         else
-            radioButton = std::make_shared<RadioButton>();
+            radioButton = makePooled<RadioButton>();
 
         loadWidget(node, radioButton);
         if (node->propertyValuePairs["text"])
@@ -709,13 +711,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_API Widget::Ptr loadScrollablePanel(std::shared_ptr<DataIO::Node> node, Widget::Ptr widget = nullptr)
+    {
+        ScrollablePanel::Ptr panel;
+        if (widget)
+            panel = std::static_pointer_cast<ScrollablePanel>(widget);
+        else
+            panel = makePooled<ScrollablePanel>();
+
+        if (node->propertyValuePairs["contentheight"])
+            panel->setContentHeight(tgui::stof(node->propertyValuePairs["contentheight"]->value));
+
+        for (auto& childNode : node->children)
+        {
+            if (toLower(childNode->name) == "verticalscrollbar")
+                panel->setScrollbar(std::static_pointer_cast<Scrollbar>(WidgetLoader::getLoadFunction("scrollbar")(childNode)));
+        }
+        REMOVE_CHILD("verticalscrollbar");
+
+        loadContainer(node, panel);
+
+        if (node->propertyValuePairs["scrolloffset"])
+            panel->setScrollOffset(tgui::stof(node->propertyValuePairs["scrolloffset"]->value));
+
+        return panel;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_API Widget::Ptr loadScrollbar(std::shared_ptr<DataIO::Node> node, Widget::Ptr widget = nullptr)
     {
         Scrollbar::Ptr scrollbar;
         if (widget)
             scrollbar = std::static_pointer_cast<Scrollbar>(widget);
         else
-            scrollbar = std::make_shared<Scrollbar>();
+            scrollbar = makePooled<Scrollbar>();
 
         loadWidget(node, scrollbar);
         if (node->propertyValuePairs["lowvalue"])
@@ -740,7 +770,7 @@ namespace tgui
         if (widget)
             slider = std::static_pointer_cast<Slider>(widget);
         else
-            slider = std::make_shared<Slider>();
+            slider = makePooled<Slider>();
 
         loadWidget(node, slider);
         if (node->propertyValuePairs["minimum"])
@@ -761,7 +791,7 @@ namespace tgui
         if (widget)
             spinButton = std::static_pointer_cast<SpinButton>(widget);
         else
-            spinButton = std::make_shared<SpinButton>();
+            spinButton = makePooled<SpinButton>();
 
         loadWidget(node, spinButton);
         if (node->propertyValuePairs["minimum"])
@@ -784,7 +814,7 @@ namespace tgui
         if (widget)
             tab = std::static_pointer_cast<Tab>(widget);
         else
-            tab = std::make_shared<Tab>();
+            tab = makePooled<Tab>();
 
         loadWidget(node, tab);
 
@@ -817,7 +847,7 @@ namespace tgui
         if (widget)
             textBox = std::static_pointer_cast<TextBox>(widget);
         else
-            textBox = std::make_shared<TextBox>();
+            textBox = makePooled<TextBox>();
 
         loadWidget(node, textBox);
 
@@ -841,6 +871,16 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_API Widget::Ptr loadThreadedCanvas(std::shared_ptr<DataIO::Node> node, Widget::Ptr widget = nullptr)
+    {
+        if (widget)
+            return loadWidget(node, widget);
+        else
+            return loadWidget(node, makePooled<ThreadedCanvas>());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -869,19 +909,26 @@ namespace tgui
             {"picture", std::bind(loadPicture, std::placeholders::_1, std::shared_ptr<Picture>{})},
             {"progressbar", std::bind(loadProgressBar, std::placeholders::_1, std::shared_ptr<ProgressBar>{})},
             {"radiobutton", std::bind(loadRadioButton, std::placeholders::_1, std::shared_ptr<RadioButton>{})},
+            {"scrollablepanel", std::bind(loadScrollablePanel, std::placeholders::_1, std::shared_ptr<ScrollablePanel>{})},
             {"scrollbar", std::bind(loadScrollbar, std::placeholders::_1, std::shared_ptr<Scrollbar>{})},
             {"slider", std::bind(loadSlider, std::placeholders::_1, std::shared_ptr<Slider>{})},
             {"spinbutton", std::bind(loadSpinButton, std::placeholders::_1, std::shared_ptr<SpinButton>{})},
             {"tab", std::bind(loadTab, std::placeholders::_1, std::shared_ptr<Tab>{})},
-            {"textbox", std::bind(loadTextBox, std::placeholders::_1, std::shared_ptr<TextBox>{})}
+            {"textbox", std::bind(loadTextBox, std::placeholders::_1, std::shared_ptr<TextBox>{})},
+            {"threadedcanvas", std::bind(loadThreadedCanvas, std::placeholders::_1, std::shared_ptr<ThreadedCanvas>{})}
         };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetLoader::load(Container::Ptr parent, std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        load(parent, DataIO::parse(stream));
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::load(Container::Ptr parent, std::shared_ptr<DataIO::Node> rootNode)
+    {
         if (rootNode->propertyValuePairs.size() != 0)
             loadWidget(rootNode, parent);
 
@@ -35,6 +35,7 @@
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/Slider.hpp>
 #include <TGUI/Widgets/SpinButton.hpp>
@@ -361,8 +362,10 @@ namespace tgui
             std::string itemIdList = "[" + Serializer::serialize(ids[0]);
             for (std::size_t i = 1; i < items.size(); ++i)
             {
-                itemList += ", " + Serializer::serialize(items[i]);
-                itemIdList += ", " + Serializer::serialize(ids[i]);
+                itemList += ", ";
+                itemList += Serializer::serialize(items[i]);
+                itemIdList += ", ";
+                itemIdList += Serializer::serialize(ids[i]);
             }
             itemList += "]";
             itemIdList += "]";
@@ -441,6 +444,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_API std::shared_ptr<DataIO::Node> saveScrollablePanel(ScrollablePanel::Ptr panel)
+    {
+        auto node = saveContainer(panel);
+
+        if (panel->getContentHeight() > 0)
+            SET_PROPERTY("ContentHeight", tgui::to_string(panel->getContentHeight()));
+        if (panel->getScrollOffset() > 0)
+            SET_PROPERTY("ScrollOffset", tgui::to_string(panel->getScrollOffset()));
+
+        // The scrollbar gets a different name than a child widget of the Scrollbar type
+        if (panel->getScrollbar() != nullptr)
+        {
+            node->children.push_back(WidgetSaver::getSaveFunction("scrollbar")(tgui::WidgetConverter{panel->getScrollbar()}));
+            node->children.back()->parent = node.get();
+            node->children.back()->name = "VerticalScrollbar";
+        }
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_API std::shared_ptr<DataIO::Node> saveScrollbar(Scrollbar::Ptr scrollbar)
     {
         auto node = saveWidget(scrollbar);
@@ -495,7 +520,10 @@ namespace tgui
         {
             std::string tabList = "[" + Serializer::serialize(tab->getText(0));
             for (std::size_t i = 1; i < tab->getTabsCount(); ++i)
-                tabList += ", " + Serializer::serialize(tab->getText(i));
+            {
+                tabList += ", ";
+                tabList += Serializer::serialize(tab->getText(i));
+            }
 
             tabList += "]";
             SET_PROPERTY("Tabs", tabList);
@@ -563,28 +591,36 @@ namespace tgui
             {"picture", savePicture},
             {"progressbar", saveProgressBar},
             {"radiobutton", saveRadioButton},
+            {"scrollablepanel", saveScrollablePanel},
             {"scrollbar", saveScrollbar},
             {"slider", saveSlider},
             {"spinbutton", saveSpinButton},
             {"tab", saveTab},
-            {"textbox", saveTextBox}
+            {"textbox", saveTextBox},
+            {"threadedcanvas", saveWidget}
         };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetSaver::save(Container::Ptr widget, std::stringstream& stream)
+    void WidgetSaver::save(Container::Ptr widget, std::ostream& stream)
     {
+        // The widgets are written one by one, the nodes of a widget are destroyed before the next widget is saved
         auto node = std::make_shared<DataIO::Node>();
-        for (auto& child : widget->getWidgets())
+        const auto& widgets = widget->getWidgets();
+        for (std::size_t i = 0; i < widgets.size(); ++i)
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
-            if (saveFunction)
-                node->children.emplace_back(saveFunction(WidgetConverter{child}));
-            else
-                throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
-        }
+            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(widgets[i]->getWidgetType()));
+            if (!saveFunction)
+                throw Exception{"No save function exists for widget type '" + widgets[i]->getWidgetType() + "'."};
+
+            node->children.clear();
+            node->children.emplace_back(saveFunction(WidgetConverter{widgets[i]}));
 
-        DataIO::emit(node, stream);
+            if (i > 0)
+                stream << '\n';
+
+            DataIO::emit(node, stream);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
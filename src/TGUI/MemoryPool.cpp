@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/MemoryPool.hpp>
+
+#include <cassert>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Block sizes are rounded up to a multiple of the granularity, which also keeps the blocks aligned
+    const std::size_t granularity = 16;
+    const std::size_t sizeClassCount = tgui::MemoryPool::MaxBlockSize / granularity;
+    const std::size_t chunkSize = 64 * 1024;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        FreeBlock* freeBlocks = nullptr;
+        std::size_t reservedMemory = 0;
+        std::size_t usedBlocks = 0;
+    };
+
+    // The size classes are never destroyed, because widgets in global variables can still be destroyed after this file
+    // would have been cleaned up. The memory that is still reserved at exit is released by the operating system.
+    SizeClass* getSizeClasses()
+    {
+        static SizeClass* sizeClasses = new SizeClass[sizeClassCount];
+        return sizeClasses;
+    }
+
+    std::size_t getSizeClassIndex(std::size_t size)
+    {
+        assert(size > 0 && size <= tgui::MemoryPool::MaxBlockSize);
+        return (size - 1) / granularity;
+    }
+
+    // Cuts a new chunk into blocks and puts them in the free list
+    void addChunk(SizeClass& sizeClass, std::size_t blockSize)
+    {
+        const std::size_t blockCount = chunkSize / blockSize;
+        char* chunk = static_cast<char*>(::operator new(blockCount * blockSize));
+
+        for (std::size_t i = blockCount; i > 0; --i)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * blockSize);
+            block->next = sizeClass.freeBlocks;
+            sizeClass.freeBlocks = block;
+        }
+
+        sizeClass.reservedMemory += blockCount * blockSize;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::atomic<bool> MemoryPool::m_enabled{false};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryPool::setEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryPool::getReservedMemory()
+    {
+        std::size_t reservedMemory = 0;
+        SizeClass* sizeClasses = getSizeClasses();
+        for (std::size_t i = 0; i < sizeClassCount; ++i)
+        {
+            std::lock_guard<std::mutex> lock{sizeClasses[i].mutex};
+            reservedMemory += sizeClasses[i].reservedMemory;
+        }
+
+        return reservedMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryPool::getUsedBlockCount()
+    {
+        std::size_t usedBlocks = 0;
+        SizeClass* sizeClasses = getSizeClasses();
+        for (std::size_t i = 0; i < sizeClassCount; ++i)
+        {
+            std::lock_guard<std::mutex> lock{sizeClasses[i].mutex};
+            usedBlocks += sizeClasses[i].usedBlocks;
+        }
+
+        return usedBlocks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* MemoryPool::allocate(std::size_t size)
+    {
+        const std::size_t index = getSizeClassIndex(size);
+        SizeClass& sizeClass = getSizeClasses()[index];
+
+        std::lock_guard<std::mutex> lock{sizeClass.mutex};
+        if (!sizeClass.freeBlocks)
+            addChunk(sizeClass, (index + 1) * granularity);
+
+        FreeBlock* block = sizeClass.freeBlocks;
+        sizeClass.freeBlocks = block->next;
+        ++sizeClass.usedBlocks;
+        return block;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryPool::deallocate(void* pointer, std::size_t size)
+    {
+        if (!pointer)
+            return;
+
+        SizeClass& sizeClass = getSizeClasses()[getSizeClassIndex(size)];
+
+        std::lock_guard<std::mutex> lock{sizeClass.mutex};
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = sizeClass.freeBlocks;
+        sizeClass.freeBlocks = block;
+        --sizeClass.usedBlocks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,288 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Exception.hpp>
+
+#include <fstream>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const std::size_t maxTraceEvents = 1000000;
+
+    std::string escapeJson(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+                result += '\\';
+
+            result += c;
+        }
+
+        return result;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::atomic<bool> Profiler::m_enabled{false};
+    std::mutex Profiler::m_mutex;
+    sf::Clock Profiler::m_clock;
+    sf::Time Profiler::m_lastFrameEnd;
+    Profiler::FrameStats Profiler::m_currentFrame;
+    Profiler::FrameStats Profiler::m_lastFrame;
+    std::map<std::pair<std::thread::id, std::string>, unsigned int> Profiler::m_activeScopes;
+    bool Profiler::m_tracing = false;
+    std::vector<Profiler::TraceEvent> Profiler::m_traceEvents;
+    std::vector<Profiler::FrameCounters> Profiler::m_traceCounters;
+    std::map<std::thread::id, unsigned int> Profiler::m_threadIndices;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isAvailable()
+    {
+#ifdef TGUI_ENABLE_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        if (enabled && !m_enabled)
+        {
+            // Don't let the first frame include the time during which the profiler was disabled
+            m_currentFrame = {};
+            m_lastFrameEnd = m_clock.getElapsedTime();
+        }
+
+        m_enabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::FrameStats Profiler::getLastFrameStats()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_lastFrame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::startTrace()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        m_traceEvents.clear();
+        m_traceCounters.clear();
+        m_tracing = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::stopTrace()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_tracing = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Profiler::getTrace()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        std::stringstream stream;
+        stream << "{\"traceEvents\":[\n";
+
+        bool first = true;
+        for (const auto& event : m_traceEvents)
+        {
+            if (!first)
+                stream << ",\n";
+            first = false;
+
+            stream << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\"" << event.category
+                   << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+                   << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+        }
+
+        for (const auto& counters : m_traceCounters)
+        {
+            if (!first)
+                stream << ",\n";
+            first = false;
+
+            stream << "{\"name\":\"Frame\",\"ph\":\"C\",\"pid\":0,\"tid\":0,\"ts\":" << counters.time
+                   << ",\"args\":{\"drawCalls\":" << counters.drawCalls
+                   << ",\"vertices\":" << counters.vertices
+                   << ",\"scissorChanges\":" << counters.scissorChanges
+                   << ",\"signalEmissions\":" << counters.signalEmissions << "}}";
+        }
+
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return stream.str();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::saveTrace(const std::string& filename)
+    {
+        std::ofstream file{filename};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the trace to it."};
+
+        file << getTrace();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::endFrame()
+    {
+        if (!isEnabled())
+            return;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        const sf::Time now = m_clock.getElapsedTime();
+        m_currentFrame.frameTime = now - m_lastFrameEnd;
+        m_lastFrameEnd = now;
+
+        if (m_tracing && (m_traceCounters.size() < maxTraceEvents))
+        {
+            m_traceCounters.push_back({now.asMicroseconds(), m_currentFrame.drawCalls, m_currentFrame.vertices,
+                                       m_currentFrame.scissorChanges, m_currentFrame.signalEmissions});
+        }
+
+        m_lastFrame = std::move(m_currentFrame);
+        m_currentFrame = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::countDrawCall(std::size_t vertexCount)
+    {
+        if (!isEnabled())
+            return;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_currentFrame.drawCalls;
+        m_currentFrame.vertices += vertexCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::countScissorChange()
+    {
+        if (!isEnabled())
+            return;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_currentFrame.scissorChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::countSignalEmission()
+    {
+        if (!isEnabled())
+            return;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_currentFrame.signalEmissions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Profiler::beginScope(const char* category, const char* name)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_activeScopes[{std::this_thread::get_id(), std::string{category} + "/" + name}];
+        return m_clock.getElapsedTime();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::endScope(const char* category, const char* name, sf::Time startTime)
+    {
+        const sf::Time endTime = m_clock.getElapsedTime();
+        const std::thread::id threadId = std::this_thread::get_id();
+        std::string key = std::string{category} + "/" + name;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        // Only the outer scope is added to the total time, the time of a recursive call is already part of it
+        auto activeIt = m_activeScopes.find({threadId, key});
+        const bool outerScope = (activeIt == m_activeScopes.end()) || (activeIt->second <= 1);
+        if (activeIt != m_activeScopes.end())
+        {
+            if (activeIt->second <= 1)
+                m_activeScopes.erase(activeIt);
+            else
+                --activeIt->second;
+        }
+
+        auto& stats = m_currentFrame.scopes[std::move(key)];
+        ++stats.calls;
+        if (outerScope)
+            stats.time += endTime - startTime;
+
+        if (m_tracing && (m_traceEvents.size() < maxTraceEvents))
+        {
+            m_traceEvents.push_back({name, category, getThreadIndex(threadId),
+                                     startTime.asMicroseconds(), (endTime - startTime).asMicroseconds()});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Profiler::getThreadIndex(std::thread::id id)
+    {
+        auto it = m_threadIndices.find(id);
+        if (it != m_threadIndices.end())
+            return it->second;
+
+        const unsigned int index = static_cast<unsigned int>(m_threadIndices.size());
+        m_threadIndices[id] = index;
+        return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,280 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/RichText.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    bool isMarkupCharacter(sf::Uint32 character)
+    {
+        return (character == '*') || (character == '~') || (character == '_') || (character == '#');
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool isSpace(sf::Uint32 character)
+    {
+        return (character == ' ') || (character == '\t') || (character == '\r') || (character == '\n');
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void addQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f topLeft, sf::Vector2f topRight, sf::Vector2f bottomLeft,
+                 sf::Vector2f bottomRight, sf::FloatRect texCoords, const sf::Color& color)
+    {
+        const sf::Vector2f texTopLeft{texCoords.left, texCoords.top};
+        const sf::Vector2f texTopRight{texCoords.left + texCoords.width, texCoords.top};
+        const sf::Vector2f texBottomLeft{texCoords.left, texCoords.top + texCoords.height};
+        const sf::Vector2f texBottomRight{texCoords.left + texCoords.width, texCoords.top + texCoords.height};
+
+        vertices.emplace_back(topLeft, color, texTopLeft);
+        vertices.emplace_back(topRight, color, texTopRight);
+        vertices.emplace_back(bottomLeft, color, texBottomLeft);
+        vertices.emplace_back(bottomLeft, color, texBottomLeft);
+        vertices.emplace_back(topRight, color, texTopRight);
+        vertices.emplace_back(bottomRight, color, texBottomRight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Adds a horizontal line (for underlined or striked through text), the pixel at (1,1) in the font texture is always white
+    void addHorizontalLine(std::vector<sf::Vertex>& vertices, float left, float right, float top, float thickness, const sf::Color& color)
+    {
+        if (right > left)
+            addQuad(vertices, {left, top}, {right, top}, {left, top + thickness}, {right, top + thickness}, {1, 1, 1, 1}, color);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RichText::RichText(const sf::String& markup, const std::map<sf::String, sf::Color>& colors, const sf::Color& defaultColor)
+    {
+        std::basic_string<sf::Uint32> text;
+        text.reserve(markup.getSize());
+
+        sf::Uint32 style = sf::Text::Regular;
+        sf::Color color = defaultColor;
+
+        // Adds a run for the characters that were added since the previous run, or extends the previous
+        // run when nothing changed since then (e.g. because the same style was toggled twice)
+        auto closeRun = [&]{
+            const std::size_t first = m_runs.empty() ? 0 : m_runs.back().first + m_runs.back().length;
+            if (first == text.size())
+                return;
+
+            if (!m_runs.empty() && (m_runs.back().style == style) && (m_runs.back().color == color))
+                m_runs.back().length = text.size() - m_runs.back().first;
+            else
+                m_runs.push_back({first, text.size() - first, style, color});
+        };
+
+        for (std::size_t i = 0; i < markup.getSize(); ++i)
+        {
+            switch (markup[i])
+            {
+                case '*':
+                    closeRun();
+                    style ^= sf::Text::Bold;
+                    break;
+
+                case '~':
+                    closeRun();
+                    style ^= sf::Text::Italic;
+                    break;
+
+                case '_':
+                    closeRun();
+                    style ^= sf::Text::Underlined;
+                    break;
+
+                case '#':
+                {
+                    closeRun();
+
+                    std::size_t end = i + 1;
+                    while ((end < markup.getSize()) && !isSpace(markup[end]))
+                        ++end;
+
+                    color = findColor(markup.substring(i + 1, end - i - 1), colors);
+
+                    // The whitespace that ends the name is removed, unless it starts a new line
+                    if ((end < markup.getSize()) && (markup[end] == '\n'))
+                        i = end - 1;
+                    else
+                        i = end;
+
+                    break;
+                }
+
+                case '\\':
+                {
+                    if ((i + 1 < markup.getSize()) && isMarkupCharacter(markup[i + 1]))
+                        ++i;
+
+                    text += markup[i];
+                    break;
+                }
+
+                default:
+                    text += markup[i];
+                    break;
+            }
+        }
+
+        closeRun();
+        m_text = text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f RichText::createVertices(const sf::Font& font, unsigned int characterSize, std::vector<sf::Vertex>& vertices) const
+    {
+        const float lineSpacing = font.getLineSpacing(characterSize);
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Vector2f size;
+        sf::Uint32 prevChar = 0;
+
+        vertices.reserve(vertices.size() + 6 * m_text.getSize());
+        for (const auto& run : m_runs)
+        {
+            const bool bold = (run.style & sf::Text::Bold) != 0;
+            const float italicShear = (run.style & sf::Text::Italic) ? 0.209f : 0.f;
+            const float lineThickness = characterSize * (bold ? 0.1f : 0.07f);
+            const float whitespaceWidth = static_cast<float>(font.getGlyph(' ', characterSize, bold).advance);
+
+            // Underlines and strike-throughs are drawn per run, for the part of the run on each line
+            float lineStart = x;
+            auto addLines = [&]{
+                if (run.style & sf::Text::Underlined)
+                    addHorizontalLine(vertices, lineStart, x, y + characterSize * 0.1f, lineThickness, run.color);
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                if (run.style & sf::Text::StrikeThrough)
+                {
+                    const sf::FloatRect xBounds = font.getGlyph('x', characterSize, bold).bounds;
+                    addHorizontalLine(vertices, lineStart, x, y + xBounds.top + xBounds.height / 2.f, lineThickness, run.color);
+                }
+#endif
+            };
+
+            for (std::size_t i = run.first; i < run.first + run.length; ++i)
+            {
+                const sf::Uint32 curChar = m_text[i];
+                if (curChar == '\n')
+                {
+                    addLines();
+                    size.x = std::max(size.x, x);
+                    size.y = std::max(size.y, y);
+
+                    x = 0;
+                    y += lineSpacing;
+                    lineStart = 0;
+                    prevChar = 0;
+                    continue;
+                }
+
+                x += static_cast<float>(font.getKerning(prevChar, curChar, characterSize));
+                prevChar = curChar;
+
+                if (curChar == ' ')
+                {
+                    x += whitespaceWidth;
+                    continue;
+                }
+                else if (curChar == '\t')
+                {
+                    x += whitespaceWidth * 4;
+                    continue;
+                }
+
+                const sf::Glyph& glyph = font.getGlyph(curChar, characterSize, bold);
+
+                const float left = glyph.bounds.left;
+                const float top = glyph.bounds.top;
+                const float right = glyph.bounds.left + glyph.bounds.width;
+                const float bottom = glyph.bounds.top + glyph.bounds.height;
+
+                addQuad(vertices,
+                        {x + left - italicShear * top, y + top},
+                        {x + right - italicShear * top, y + top},
+                        {x + left - italicShear * bottom, y + bottom},
+                        {x + right - italicShear * bottom, y + bottom},
+                        {static_cast<float>(glyph.textureRect.left), static_cast<float>(glyph.textureRect.top),
+                         static_cast<float>(glyph.textureRect.width), static_cast<float>(glyph.textureRect.height)},
+                        run.color);
+
+                size.y = std::max(size.y, y + bottom);
+                x += glyph.advance;
+            }
+
+            addLines();
+        }
+
+        size.x = std::max(size.x, x);
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Color RichText::findColor(const sf::String& name, const std::map<sf::String, sf::Color>& colors)
+    {
+        const auto it = colors.find(name);
+        if (it != colors.end())
+            return it->second;
+
+        if ((name.getSize() == 0) || (name.getSize() > 8))
+            return sf::Color::White;
+
+        sf::Uint32 value = 0;
+        for (auto c = name.begin(); c != name.end(); ++c)
+        {
+            value <<= 4;
+            if ((*c >= '0') && (*c <= '9'))
+                value += *c - '0';
+            else if ((*c >= 'a') && (*c <= 'f'))
+                value += *c - 'a' + 10;
+            else if ((*c >= 'A') && (*c <= 'F'))
+                value += *c - 'A' + 10;
+            else
+                return sf::Color::White;
+        }
+
+        // The alpha value is ignored, the text is always opaque
+        return {static_cast<sf::Uint8>(value >> 16), static_cast<sf::Uint8>(value >> 8), static_cast<sf::Uint8>(value), 255};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
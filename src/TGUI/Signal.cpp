@@ -25,6 +25,8 @@
 
 #include <TGUI/Signal.hpp>
 
+#include <mutex>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -34,17 +36,18 @@ namespace tgui
     std::deque<const void*> priv::data; // deque because vector could reallocate when resizing after parameters are already bound
     unsigned int SignalWidgetBase::m_lastId = 0;
 
+    namespace
+    {
+        // The signal infos are never removed, they are shared by all widgets that will ever be created
+        std::mutex signalInfoMutex;
+        std::map<std::pair<const priv::SignalInfo*, std::string>, std::unique_ptr<priv::SignalInfo>> signalInfos;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal::Signal(std::vector<std::vector<std::string>>&& types)
+    Signal::Signal(const std::vector<std::vector<std::string>>& types) :
+        m_allowedTypes{&types}
     {
-        std::size_t maxSize = 0;
-        for (auto& typeList : types)
-            maxSize += typeList.size();
-
-        m_allowedTypes = types;
-        if (maxSize > priv::data.size())
-            priv::data.resize(maxSize, nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,10 +85,11 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SignalWidgetBase::SignalWidgetBase(const SignalWidgetBase& copy)
+    SignalWidgetBase::SignalWidgetBase(const SignalWidgetBase& copy) :
+        m_signalInfo{copy.m_signalInfo}
     {
         for (auto& signal : copy.m_signals)
-            m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+            m_signals[signal.first] = makePooled<Signal>(*signal.second);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,8 +98,11 @@ namespace tgui
     {
         if (this != &right)
         {
+            m_signalInfo = right.m_signalInfo;
+
+            m_signals.clear();
             for (auto& signal : right.m_signals)
-                m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+                m_signals[signal.first] = makePooled<Signal>(*signal.second);
         }
 
         return *this;
@@ -105,10 +112,16 @@ namespace tgui
 
     void SignalWidgetBase::disconnect(unsigned int id)
     {
-        for (auto& signal : m_signals)
+        for (auto it = m_signals.begin(); it != m_signals.end(); ++it)
         {
-            if (signal.second->disconnect(id))
+            if (it->second->disconnect(id))
+            {
+                // Release the handler storage when the last handler was removed
+                if (it->second->isEmpty() && it->second->m_functionsEx.empty())
+                    m_signals.erase(it);
+
                 return;
+            }
         }
 
         throw Exception{"Failed to disconnect signal handler. There is no function bound to the given id " + tgui::to_string(id) + "."};
@@ -119,23 +132,32 @@ namespace tgui
     void SignalWidgetBase::disconnectAll(const std::string& signalName)
     {
         for (auto& name : extractSignalNames(signalName))
-            m_signals.at(toLower(name))->disconnectAll();
+        {
+            if (!findSignalInfo(toLower(name)))
+                throw Exception{"Cannot disconnect from unknown signal '" + name + "'."};
+
+            m_signals.erase(toLower(name));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SignalWidgetBase::disconnectAll()
     {
-        for (auto& signal : m_signals)
-            signal.second->disconnectAll();
+        m_signals.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalWidgetBase::isSignalBound(std::string&& name)
     {
-        assert(m_signals[toLower(name)]);
-        return !m_signals[toLower(name)]->isEmpty() || !m_signals[toLower(name)]->m_functionsEx.empty();
+        assert(findSignalInfo(toLower(name)) != nullptr);
+
+        const auto it = m_signals.find(toLower(name));
+        if (it == m_signals.end())
+            return false;
+
+        return !it->second->isEmpty() || !it->second->m_functionsEx.empty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +183,54 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const priv::SignalInfo* SignalWidgetBase::findSignalInfo(const std::string& name) const
+    {
+        for (const priv::SignalInfo* info = m_signalInfo; info != nullptr; info = info->next)
+        {
+            if (info->name == name)
+                return info;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& SignalWidgetBase::getSignal(const priv::SignalInfo& info)
+    {
+        auto& signal = m_signals[info.name];
+        if (!signal)
+            signal = makePooled<Signal>(info.types);
+
+        return *signal;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const priv::SignalInfo* SignalWidgetBase::registerSignal(const priv::SignalInfo* next, std::string&& name,
+                                                             std::vector<std::vector<std::string>>(*getTypes)())
+    {
+        std::lock_guard<std::mutex> lock{signalInfoMutex};
+
+        auto& info = signalInfos[std::make_pair(next, name)];
+        if (!info)
+        {
+            info = std::unique_ptr<priv::SignalInfo>(new priv::SignalInfo{next, std::move(name), getTypes()});
+
+            // Make sure there is room for the parameters when the signal is send
+            std::size_t maxSize = 0;
+            for (auto& typeList : info->types)
+                maxSize += typeList.size();
+
+            if (maxSize > priv::data.size())
+                priv::data.resize(maxSize, nullptr);
+        }
+
+        return info.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,465 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void addQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f topLeft, sf::Vector2f topRight, sf::Vector2f bottomLeft,
+                 sf::Vector2f bottomRight, sf::FloatRect texCoords)
+    {
+        const sf::Vector2f texTopLeft{texCoords.left, texCoords.top};
+        const sf::Vector2f texTopRight{texCoords.left + texCoords.width, texCoords.top};
+        const sf::Vector2f texBottomLeft{texCoords.left, texCoords.top + texCoords.height};
+        const sf::Vector2f texBottomRight{texCoords.left + texCoords.width, texCoords.top + texCoords.height};
+
+        vertices.emplace_back(topLeft, sf::Color::White, texTopLeft);
+        vertices.emplace_back(topRight, sf::Color::White, texTopRight);
+        vertices.emplace_back(bottomLeft, sf::Color::White, texBottomLeft);
+        vertices.emplace_back(bottomLeft, sf::Color::White, texBottomLeft);
+        vertices.emplace_back(topRight, sf::Color::White, texTopRight);
+        vertices.emplace_back(bottomRight, sf::Color::White, texBottomRight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Adds a horizontal line (for underlined or striked through text) that uses a solid part of the texture
+    void addHorizontalLine(std::vector<sf::Vertex>& vertices, float width, float top, float thickness, sf::FloatRect solidRect)
+    {
+        addQuad(vertices, {0, top}, {width, top}, {0, top + thickness}, {width, top + thickness}, solidRect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Glyph metrics of an sf::Font, of which the glyphs are rasterized at the character size
+    struct FontGlyphMetrics
+    {
+        const sf::Font& font;
+        unsigned int characterSize;
+        bool bold;
+
+        float getWidth(sf::Uint32 codePoint) const
+        {
+            return static_cast<float>(font.getGlyph(codePoint, characterSize, bold).textureRect.width);
+        }
+
+        float getAdvance(sf::Uint32 codePoint) const
+        {
+            return static_cast<float>(font.getGlyph(codePoint, characterSize, bold).advance);
+        }
+
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const
+        {
+            return static_cast<float>(font.getKerning(first, second, characterSize));
+        }
+
+        sf::FloatRect getBounds(sf::Uint32 codePoint) const
+        {
+            return font.getGlyph(codePoint, characterSize, bold).bounds;
+        }
+
+        sf::FloatRect getTextureRect(sf::Uint32 codePoint) const
+        {
+            const sf::IntRect& rect = font.getGlyph(codePoint, characterSize, bold).textureRect;
+            return {static_cast<float>(rect.left), static_cast<float>(rect.top), static_cast<float>(rect.width), static_cast<float>(rect.height)};
+        }
+
+        // The pixel at (1,1) in the font texture is always white
+        sf::FloatRect getSolidRect() const
+        {
+            return {1, 1, 1, 1};
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Glyph metrics of a distance field atlas, of which the glyphs are scaled to the character size
+    struct DistanceFieldGlyphMetrics
+    {
+        tgui::DistanceFieldFont& font;
+        float scale;
+        bool bold;
+
+        // The bounds contain the spread around the glyph, which isn't part of its width
+        float getWidth(sf::Uint32 codePoint) const
+        {
+            const auto& glyph = font.getGlyph(codePoint, bold);
+            if (glyph.bounds.width == 0)
+                return 0;
+
+            return (glyph.bounds.width - 2.f * font.getSpread() / font.getReferenceSize()) * scale;
+        }
+
+        float getAdvance(sf::Uint32 codePoint) const
+        {
+            return font.getGlyph(codePoint, bold).advance * scale;
+        }
+
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const
+        {
+            return font.getKerning(first, second) * scale;
+        }
+
+        sf::FloatRect getBounds(sf::Uint32 codePoint) const
+        {
+            const sf::FloatRect& bounds = font.getGlyph(codePoint, bold).bounds;
+            return {bounds.left * scale, bounds.top * scale, bounds.width * scale, bounds.height * scale};
+        }
+
+        sf::FloatRect getTextureRect(sf::Uint32 codePoint) const
+        {
+            return font.getGlyph(codePoint, bold).textureRect;
+        }
+
+        sf::FloatRect getSolidRect() const
+        {
+            return font.getSolidRect();
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t hashText(const sf::String& text)
+    {
+        // FNV-1a
+        std::size_t hash = 2166136261u;
+        for (auto it = text.begin(); it != text.end(); ++it)
+        {
+            hash ^= *it;
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t combineHash(std::size_t hash, std::size_t value)
+    {
+        return hash ^ (value + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::list<TextLayoutCache::Entry> TextLayoutCache::m_entries;
+    std::unordered_multimap<std::size_t, std::list<TextLayoutCache::Entry>::iterator> TextLayoutCache::m_lookup;
+    std::size_t TextLayoutCache::m_capacity = 1024;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLayout::TextLayout(const sf::String& text, const sf::Font& font, unsigned int characterSize, sf::Uint32 style, float maxWidth)
+    {
+        TGUI_PROFILE_SCOPE("Text", "TextLayout");
+
+        const FontGlyphMetrics metrics{font, characterSize, (style & sf::Text::Bold) != 0};
+
+        std::size_t index = 0;
+        while (index < text.getSize())
+            index = addLine(text, index, metrics, characterSize, style, maxWidth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextLayout::TextLayout(const sf::String& text, std::shared_ptr<DistanceFieldFont> font, unsigned int characterSize, sf::Uint32 style, float maxWidth) :
+        m_distanceFieldFont{std::move(font)}
+    {
+        TGUI_PROFILE_SCOPE("Text", "TextLayout");
+
+        const bool bold = (style & sf::Text::Bold) != 0;
+        m_distanceFieldFont->loadGlyphs(text, bold);
+
+        const DistanceFieldGlyphMetrics metrics{*m_distanceFieldFont, static_cast<float>(characterSize), bold};
+
+        std::size_t index = 0;
+        while (index < text.getSize())
+            index = addLine(text, index, metrics, characterSize, style, maxWidth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename GlyphMetrics>
+    std::size_t TextLayout::addLine(const sf::String& text, std::size_t index, const GlyphMetrics& metrics, unsigned int characterSize, sf::Uint32 style, float maxWidth)
+    {
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const std::size_t oldIndex = index;
+
+        // Find out how many characters fit on the line
+        float width = 0;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = index; i < text.getSize(); ++i)
+        {
+            float charWidth;
+            sf::Uint32 curChar = text[i];
+            if (curChar == '\n')
+            {
+                index++;
+                break;
+            }
+            else if (curChar == '\t')
+                charWidth = metrics.getWidth(' ') * 4;
+            else
+                charWidth = metrics.getWidth(curChar);
+
+            float kerning = metrics.getKerning(prevChar, curChar);
+            if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+            {
+                if (curChar == '\t')
+                    width += (metrics.getAdvance(' ') * 4) + kerning;
+                else
+                    width += metrics.getAdvance(curChar) + kerning;
+
+                index++;
+            }
+            else
+                break;
+
+            prevChar = curChar;
+        }
+
+        m_width = std::max(m_width, width);
+
+        // Every line contains at least one character
+        if (index == oldIndex)
+            index++;
+
+        // Implement the word-wrap
+        if (text[index-1] != '\n')
+        {
+            std::size_t indexWithoutWordWrap = index;
+
+            if ((index < text.getSize()) && (!isWhitespace(text[index])))
+            {
+                std::size_t wordWrapCorrection = 0;
+                while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
+                {
+                    wordWrapCorrection++;
+                    index--;
+                }
+
+                // The word can't be split but there is no other choice, it does not fit on the line
+                if ((index - oldIndex) <= wordWrapCorrection)
+                    index = indexWithoutWordWrap;
+            }
+        }
+
+        // Create the glyphs in the same way as sf::Text does
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f;
+        const float whitespaceWidth = metrics.getAdvance(' ');
+
+        Line line;
+        line.firstVertex = m_vertices.size();
+        line.width = 0;
+
+        float x = 0;
+        const float y = static_cast<float>(characterSize);
+        prevChar = 0;
+        for (std::size_t i = oldIndex; i < index; ++i)
+        {
+            const sf::Uint32 curChar = text[i];
+            if (curChar == '\n')
+                break;
+
+            x += metrics.getKerning(prevChar, curChar);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+
+            const sf::FloatRect bounds = metrics.getBounds(curChar);
+
+            const float left = bounds.left;
+            const float top = bounds.top;
+            const float right = bounds.left + bounds.width;
+            const float bottom = bounds.top + bounds.height;
+
+            addQuad(m_vertices,
+                    {x + left - italicShear * top, y + top},
+                    {x + right - italicShear * top, y + top},
+                    {x + left - italicShear * bottom, y + bottom},
+                    {x + right - italicShear * bottom, y + bottom},
+                    metrics.getTextureRect(curChar));
+
+            x += metrics.getAdvance(curChar);
+
+            if (!isWhitespace(curChar))
+                line.width = x;
+        }
+
+        if (underlined && (x > 0))
+            addHorizontalLine(m_vertices, x, y + characterSize * 0.1f, characterSize * (bold ? 0.1f : 0.07f), metrics.getSolidRect());
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        if ((style & sf::Text::StrikeThrough) && (x > 0))
+        {
+            const sf::FloatRect xBounds = metrics.getBounds('x');
+            addHorizontalLine(m_vertices, x, y + xBounds.top + xBounds.height / 2.f, characterSize * (bold ? 0.1f : 0.07f), metrics.getSolidRect());
+        }
+#endif
+
+        line.vertexCount = m_vertices.size() - line.firstVertex;
+        m_lines.push_back(line);
+
+        // If the next line starts with just a space, then the space need not be visible
+        if ((index < text.getSize()) && (text[index] == ' '))
+        {
+            if ((index == 0) || (!isWhitespace(text[index-1])))
+            {
+                // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
+                    index++;
+            }
+        }
+
+        return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const TextLayout> TextLayoutCache::getLayout(const sf::String& text, const std::shared_ptr<sf::Font>& font,
+                                                                 unsigned int characterSize, sf::Uint32 style, float maxWidth)
+    {
+        if (!font)
+            return nullptr;
+
+        std::size_t hash = hashText(text);
+        hash = combineHash(hash, std::hash<const sf::Font*>()(font.get()));
+        hash = combineHash(hash, characterSize);
+        hash = combineHash(hash, style);
+        hash = combineHash(hash, std::hash<float>()(maxWidth));
+
+        auto range = m_lookup.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            Entry& entry = *it->second;
+            if ((entry.fontPtr != font.get()) || (entry.characterSize != characterSize) || (entry.style != style)
+             || (entry.maxWidth != maxWidth) || (entry.text != text))
+                continue;
+
+            // A different font could have been created at the address of a font that no longer exists
+            if (entry.font.expired())
+            {
+                m_entries.erase(it->second);
+                m_lookup.erase(it);
+                break;
+            }
+
+            // Move the entry to the front of the list, as it is now the most recently used one
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return entry.layout;
+        }
+
+        // Fonts for which distance fields are enabled are only drawn with them when shaders are supported
+        std::shared_ptr<const TextLayout> layout;
+        auto distanceFieldFont = DistanceFieldFont::get(font.get());
+        if (distanceFieldFont && DistanceFieldFont::getShader())
+            layout = std::make_shared<const TextLayout>(text, distanceFieldFont, characterSize, style, maxWidth);
+        else
+            layout = std::make_shared<const TextLayout>(text, *font, characterSize, style, maxWidth);
+
+        if (m_capacity == 0)
+            return layout;
+
+        shrink(m_capacity - 1);
+
+        m_entries.push_front({hash, text, font, font.get(), characterSize, style, maxWidth, layout});
+        m_lookup.insert({hash, m_entries.begin()});
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::setCapacity(std::size_t capacity)
+    {
+        m_capacity = capacity;
+        shrink(m_capacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getCapacity()
+    {
+        return m_capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getSize()
+    {
+        return m_entries.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::clear()
+    {
+        m_lookup.clear();
+        m_entries.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::shrink(std::size_t size)
+    {
+        while (m_entries.size() > size)
+        {
+            auto range = m_lookup.equal_range(m_entries.back().hash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == std::prev(m_entries.end()))
+                {
+                    m_lookup.erase(it);
+                    break;
+                }
+            }
+
+            m_entries.pop_back();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
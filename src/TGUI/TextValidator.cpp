@@ -0,0 +1,775 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextValidator.hpp>
+
+#include <SFML/System/Utf.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const sf::Uint32 maxCodePoint = 0x10FFFF;
+    const unsigned int infinite = std::numeric_limits<unsigned int>::max();
+
+    // Limits that prevent patterns like "(a|b){1000}" from using huge amounts of memory
+    const std::size_t maxNfaStates = 10000;
+    const std::size_t maxDfaStates = 2000;
+
+    // Range of code points, both ends are included
+    typedef std::pair<sf::Uint32, sf::Uint32> Range;
+
+    struct Node
+    {
+        enum class Type
+        {
+            Characters,
+            Sequence,
+            Alternatives,
+            Repeat
+        };
+
+        Type type = Type::Sequence;
+        std::vector<Range> ranges;
+        std::vector<Node> children;
+        unsigned int min = 0;
+        unsigned int max = 0;
+    };
+
+    struct NfaState
+    {
+        std::vector<std::size_t> epsilon;
+        std::vector<Range> ranges;
+        std::size_t target = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Sorts the ranges and merges the ones that overlap or touch
+    std::vector<Range> normalizeRanges(std::vector<Range> ranges)
+    {
+        std::sort(ranges.begin(), ranges.end());
+
+        std::vector<Range> merged;
+        for (const auto& range : ranges)
+        {
+            if (!merged.empty() && (range.first <= merged.back().second + 1))
+                merged.back().second = std::max(merged.back().second, range.second);
+            else
+                merged.push_back(range);
+        }
+
+        return merged;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Range> complementRanges(const std::vector<Range>& ranges)
+    {
+        std::vector<Range> complement;
+
+        sf::Uint32 start = 0;
+        for (const auto& range : normalizeRanges(ranges))
+        {
+            if (range.first > start)
+                complement.push_back({start, range.first - 1});
+
+            start = range.second + 1;
+        }
+
+        if (start <= maxCodePoint)
+            complement.push_back({start, maxCodePoint});
+
+        return complement;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    class Parser
+    {
+    public:
+
+        Parser(const std::string& pattern) :
+            m_pattern(pattern)
+        {
+            sf::Utf8::toUtf32(pattern.begin(), pattern.end(), std::back_inserter(m_chars));
+        }
+
+        Node parse()
+        {
+            Node node = parseAlternatives();
+            if (m_pos != m_chars.size())
+                error();
+
+            return node;
+        }
+
+    private:
+
+        Node parseAlternatives()
+        {
+            Node node;
+            node.type = Node::Type::Alternatives;
+            node.children.push_back(parseSequence());
+
+            while (accept('|'))
+                node.children.push_back(parseSequence());
+
+            if (node.children.size() == 1)
+                return std::move(node.children.front());
+            else
+                return node;
+        }
+
+        Node parseSequence()
+        {
+            Node node;
+            node.type = Node::Type::Sequence;
+
+            while ((m_pos < m_chars.size()) && (m_chars[m_pos] != '|') && (m_chars[m_pos] != ')'))
+            {
+                // Anchors have no effect as the pattern always has to match the entire text
+                if (accept('^') || accept('$'))
+                    continue;
+
+                Node atom = parseAtom();
+                while (parseQuantifier(atom))
+                    ;
+
+                node.children.push_back(std::move(atom));
+            }
+
+            return node;
+        }
+
+        Node parseAtom()
+        {
+            const sf::Uint32 c = m_chars[m_pos++];
+            switch (c)
+            {
+                case '(':
+                {
+                    // Capturing and non-capturing groups are treated the same
+                    if (accept('?') && !accept(':'))
+                        error();
+
+                    Node node = parseAlternatives();
+                    if (!accept(')'))
+                        error();
+
+                    return node;
+                }
+
+                case '[':
+                    return makeCharacters(parseCharacterClass());
+
+                case '.':
+                    return makeCharacters(complementRanges({{'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029}}));
+
+                case '\\':
+                    return makeCharacters(parseEscape(false));
+
+                case '*':
+                case '+':
+                case '?':
+                case '{':
+                    error();
+            }
+
+            return makeCharacters({{c, c}});
+        }
+
+        bool parseQuantifier(Node& atom)
+        {
+            unsigned int min;
+            unsigned int max;
+            if (accept('*'))
+            {
+                min = 0;
+                max = infinite;
+            }
+            else if (accept('+'))
+            {
+                min = 1;
+                max = infinite;
+            }
+            else if (accept('?'))
+            {
+                min = 0;
+                max = 1;
+            }
+            else if (accept('{'))
+            {
+                min = parseNumber();
+                max = min;
+                if (accept(','))
+                    max = (peek() == '}') ? infinite : parseNumber();
+
+                if (!accept('}') || (max < min))
+                    error();
+            }
+            else
+                return false;
+
+            // Lazy quantifiers match the same texts
+            accept('?');
+
+            Node node;
+            node.type = Node::Type::Repeat;
+            node.min = min;
+            node.max = max;
+            node.children.push_back(std::move(atom));
+            atom = std::move(node);
+            return true;
+        }
+
+        unsigned int parseNumber()
+        {
+            if ((peek() < '0') || (peek() > '9'))
+                error();
+
+            unsigned int number = 0;
+            while ((peek() >= '0') && (peek() <= '9'))
+            {
+                number = number * 10 + (m_chars[m_pos++] - '0');
+                if (number > 1000)
+                    error();
+            }
+
+            return number;
+        }
+
+        std::vector<Range> parseCharacterClass()
+        {
+            const bool negated = accept('^');
+
+            std::vector<Range> ranges;
+            while (!accept(']'))
+            {
+                if (m_pos >= m_chars.size())
+                    error();
+
+                std::vector<Range> first = parseClassAtom();
+                if ((first.size() == 1) && (first[0].first == first[0].second)
+                 && (peek() == '-') && (m_pos + 1 < m_chars.size()) && (m_chars[m_pos + 1] != ']'))
+                {
+                    ++m_pos;
+                    const std::vector<Range> last = parseClassAtom();
+                    if ((last.size() != 1) || (last[0].first != last[0].second) || (last[0].first < first[0].first))
+                        error();
+
+                    ranges.push_back({first[0].first, last[0].first});
+                }
+                else
+                    ranges.insert(ranges.end(), first.begin(), first.end());
+            }
+
+            if (negated)
+                return complementRanges(ranges);
+            else
+                return normalizeRanges(ranges);
+        }
+
+        std::vector<Range> parseClassAtom()
+        {
+            const sf::Uint32 c = m_chars[m_pos++];
+            if (c == '\\')
+                return parseEscape(true);
+            else
+                return {{c, c}};
+        }
+
+        std::vector<Range> parseEscape(bool insideClass)
+        {
+            if (m_pos >= m_chars.size())
+                error();
+
+            const sf::Uint32 c = m_chars[m_pos++];
+            switch (c)
+            {
+                case 'd': return {{'0', '9'}};
+                case 'D': return complementRanges({{'0', '9'}});
+                case 'w': return {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                case 'W': return complementRanges({{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}});
+                case 's': return {{'\t', '\r'}, {' ', ' '}, {0xA0, 0xA0}, {0x2028, 0x2029}, {0xFEFF, 0xFEFF}};
+                case 'S': return complementRanges({{'\t', '\r'}, {' ', ' '}, {0xA0, 0xA0}, {0x2028, 0x2029}, {0xFEFF, 0xFEFF}});
+                case 't': return {{'\t', '\t'}};
+                case 'n': return {{'\n', '\n'}};
+                case 'v': return {{'\v', '\v'}};
+                case 'f': return {{'\f', '\f'}};
+                case 'r': return {{'\r', '\r'}};
+                case '0': return {{0, 0}};
+                case 'x': return single(parseHex(2));
+                case 'u': return single(parseHex(4));
+                case 'b':
+                {
+                    // Word boundaries can't be checked per character, but inside a class it means backspace
+                    if (!insideClass)
+                        error();
+
+                    return {{'\b', '\b'}};
+                }
+            }
+
+            return {{c, c}};
+        }
+
+        sf::Uint32 parseHex(unsigned int digits)
+        {
+            sf::Uint32 value = 0;
+            for (unsigned int i = 0; i < digits; ++i)
+            {
+                const sf::Uint32 c = peek();
+                if ((c >= '0') && (c <= '9'))
+                    value = value * 16 + (c - '0');
+                else if ((c >= 'a') && (c <= 'f'))
+                    value = value * 16 + (c - 'a' + 10);
+                else if ((c >= 'A') && (c <= 'F'))
+                    value = value * 16 + (c - 'A' + 10);
+                else
+                    error();
+
+                ++m_pos;
+            }
+
+            return value;
+        }
+
+        static std::vector<Range> single(sf::Uint32 c)
+        {
+            return {{c, c}};
+        }
+
+        static Node makeCharacters(std::vector<Range> ranges)
+        {
+            Node node;
+            node.type = Node::Type::Characters;
+            node.ranges = std::move(ranges);
+            return node;
+        }
+
+        sf::Uint32 peek() const
+        {
+            if (m_pos < m_chars.size())
+                return m_chars[m_pos];
+            else
+                return 0;
+        }
+
+        bool accept(sf::Uint32 c)
+        {
+            if ((m_pos < m_chars.size()) && (m_chars[m_pos] == c))
+            {
+                ++m_pos;
+                return true;
+            }
+            else
+                return false;
+        }
+
+        void error() const
+        {
+            throw tgui::Exception{"Failed to compile input validator '" + m_pattern + "'."};
+        }
+
+    private:
+
+        const std::string& m_pattern;
+        std::vector<sf::Uint32> m_chars;
+        std::size_t m_pos = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    class NfaBuilder
+    {
+    public:
+
+        NfaBuilder(const std::string& pattern) :
+            m_pattern(pattern)
+        {
+        }
+
+        // Returns the start and end state of the part of the automaton that matches the node
+        std::pair<std::size_t, std::size_t> build(const Node& node)
+        {
+            switch (node.type)
+            {
+                case Node::Type::Characters:
+                {
+                    const std::size_t start = addState();
+                    const std::size_t end = addState();
+                    states[start].ranges = node.ranges;
+                    states[start].target = end;
+                    return {start, end};
+                }
+
+                case Node::Type::Sequence:
+                {
+                    const std::size_t start = addState();
+                    std::size_t end = start;
+                    for (const auto& child : node.children)
+                    {
+                        const auto part = build(child);
+                        states[end].epsilon.push_back(part.first);
+                        end = part.second;
+                    }
+
+                    return {start, end};
+                }
+
+                case Node::Type::Alternatives:
+                {
+                    const std::size_t start = addState();
+                    const std::size_t end = addState();
+                    for (const auto& child : node.children)
+                    {
+                        const auto part = build(child);
+                        states[start].epsilon.push_back(part.first);
+                        states[part.second].epsilon.push_back(end);
+                    }
+
+                    return {start, end};
+                }
+
+                case Node::Type::Repeat:
+                {
+                    const std::size_t start = addState();
+                    std::size_t end = start;
+                    for (unsigned int i = 0; i < node.min; ++i)
+                    {
+                        const auto part = build(node.children.front());
+                        states[end].epsilon.push_back(part.first);
+                        end = part.second;
+                    }
+
+                    if (node.max == infinite)
+                    {
+                        const std::size_t loop = addState();
+                        const auto part = build(node.children.front());
+                        states[end].epsilon.push_back(loop);
+                        states[loop].epsilon.push_back(part.first);
+                        states[part.second].epsilon.push_back(loop);
+                        return {start, loop};
+                    }
+                    else
+                    {
+                        const std::size_t last = addState();
+                        for (unsigned int i = node.min; i < node.max; ++i)
+                        {
+                            const auto part = build(node.children.front());
+                            states[end].epsilon.push_back(part.first);
+                            states[end].epsilon.push_back(last);
+                            end = part.second;
+                        }
+
+                        states[end].epsilon.push_back(last);
+                        return {start, last};
+                    }
+                }
+            }
+
+            return {0, 0};
+        }
+
+        std::vector<NfaState> states;
+
+    private:
+
+        std::size_t addState()
+        {
+            if (states.size() >= maxNfaStates)
+                throw tgui::Exception{"Input validator '" + m_pattern + "' is too complex."};
+
+            states.emplace_back();
+            return states.size() - 1;
+        }
+
+        const std::string& m_pattern;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Adds all states that can be reached without consuming a character and sorts the result
+    void addEpsilonClosure(const std::vector<NfaState>& states, std::vector<std::size_t>& set)
+    {
+        std::vector<bool> added(states.size(), false);
+        for (auto index : set)
+            added[index] = true;
+
+        std::vector<std::size_t> todo = set;
+        while (!todo.empty())
+        {
+            const std::size_t index = todo.back();
+            todo.pop_back();
+
+            for (auto next : states[index].epsilon)
+            {
+                if (!added[next])
+                {
+                    added[next] = true;
+                    set.push_back(next);
+                    todo.push_back(next);
+                }
+            }
+        }
+
+        std::sort(set.begin(), set.end());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    const TextValidator::State TextValidator::Rejected;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextValidator::TextValidator(const std::string& pattern) :
+        m_pattern(pattern)
+    {
+        if (m_pattern == ".*")
+            m_kind = Kind::Everything;
+        else if (m_pattern == "[+-]?[0-9]*")
+            m_kind = Kind::Int;
+        else if (m_pattern == "[0-9]*")
+            m_kind = Kind::UInt;
+        else if (m_pattern == "[+-]?[0-9]*\\.?[0-9]*")
+            m_kind = Kind::Float;
+        else
+        {
+            m_kind = Kind::Table;
+            compile();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextValidator::State TextValidator::next(State state, sf::Uint32 character) const
+    {
+        if (state == Rejected)
+            return Rejected;
+
+        const bool digit = (character >= '0') && (character <= '9');
+        switch (m_kind)
+        {
+            case Kind::Everything:
+                return 0;
+
+            case Kind::UInt:
+                return digit ? 0 : Rejected;
+
+            // States: 0 = nothing typed yet, 1 = sign, 2 = digits
+            case Kind::Int:
+                if (digit)
+                    return 2;
+                else if ((state == 0) && ((character == '+') || (character == '-')))
+                    return 1;
+                else
+                    return Rejected;
+
+            // States: 0 = nothing typed yet, 1 = sign, 2 = digits before the dot, 3 = dot was typed
+            case Kind::Float:
+                if (digit)
+                    return (state == 3) ? 3 : 2;
+                else if ((state == 0) && ((character == '+') || (character == '-')))
+                    return 1;
+                else if ((state != 3) && (character == '.'))
+                    return 3;
+                else
+                    return Rejected;
+
+            case Kind::Table:
+                return m_transitions[state * m_classCount + getCharacterClass(character)];
+        }
+
+        return Rejected;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextValidator::isAccepting(State state) const
+    {
+        if (state == Rejected)
+            return false;
+        else if (m_kind == Kind::Table)
+            return m_accepting[state];
+        else
+            return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextValidator::matches(const sf::String& text) const
+    {
+        if (m_kind == Kind::Everything)
+            return true;
+
+        State state = getStartState();
+        for (auto it = text.begin(); (it != text.end()) && (state != Rejected); ++it)
+            state = next(state, *it);
+
+        return isAccepting(state);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextValidator::compile()
+    {
+        Parser parser{m_pattern};
+        const Node root = parser.parse();
+
+        NfaBuilder builder{m_pattern};
+        const auto nfa = builder.build(root);
+        const std::vector<NfaState>& nfaStates = builder.states;
+
+        // Split the characters in classes, so that characters in the same class are either all part of a range or all not
+        m_classBoundaries.clear();
+        for (const auto& state : nfaStates)
+        {
+            for (const auto& range : state.ranges)
+            {
+                if (range.first > 0)
+                    m_classBoundaries.push_back(range.first);
+                if (range.second < std::numeric_limits<sf::Uint32>::max())
+                    m_classBoundaries.push_back(range.second + 1);
+            }
+        }
+
+        std::sort(m_classBoundaries.begin(), m_classBoundaries.end());
+        m_classBoundaries.erase(std::unique(m_classBoundaries.begin(), m_classBoundaries.end()), m_classBoundaries.end());
+        m_classCount = m_classBoundaries.size() + 1;
+
+        m_asciiClasses.resize(128);
+        for (sf::Uint32 c = 0; c < 128; ++c)
+            m_asciiClasses[c] = static_cast<unsigned int>(std::upper_bound(m_classBoundaries.begin(), m_classBoundaries.end(), c) - m_classBoundaries.begin());
+
+        // Subset construction, every state of the table corresponds to a set of states of the nondeterministic automaton
+        std::vector<std::vector<std::size_t>> sets;
+        std::map<std::vector<std::size_t>, State> stateIndices;
+
+        std::vector<std::size_t> startSet{nfa.first};
+        addEpsilonClosure(nfaStates, startSet);
+        sets.push_back(startSet);
+        stateIndices[startSet] = 0;
+
+        m_transitions.clear();
+        m_accepting.clear();
+        for (std::size_t i = 0; i < sets.size(); ++i)
+        {
+            m_accepting.push_back(std::binary_search(sets[i].begin(), sets[i].end(), nfa.second));
+
+            for (std::size_t characterClass = 0; characterClass < m_classCount; ++characterClass)
+            {
+                const sf::Uint32 character = (characterClass == 0) ? 0 : m_classBoundaries[characterClass - 1];
+
+                std::vector<std::size_t> nextSet;
+                for (auto index : sets[i])
+                {
+                    for (const auto& range : nfaStates[index].ranges)
+                    {
+                        if ((character >= range.first) && (character <= range.second))
+                        {
+                            nextSet.push_back(nfaStates[index].target);
+                            break;
+                        }
+                    }
+                }
+
+                if (nextSet.empty())
+                {
+                    m_transitions.push_back(Rejected);
+                    continue;
+                }
+
+                std::sort(nextSet.begin(), nextSet.end());
+                nextSet.erase(std::unique(nextSet.begin(), nextSet.end()), nextSet.end());
+                addEpsilonClosure(nfaStates, nextSet);
+
+                auto it = stateIndices.find(nextSet);
+                if (it == stateIndices.end())
+                {
+                    if (sets.size() >= maxDfaStates)
+                        throw Exception{"Input validator '" + m_pattern + "' is too complex."};
+
+                    it = stateIndices.insert({nextSet, static_cast<State>(sets.size())}).first;
+                    sets.push_back(std::move(nextSet));
+                }
+
+                m_transitions.push_back(it->second);
+            }
+        }
+
+        // States from which the text can never match again are replaced with Rejected, so that typing stops being checked early
+        std::vector<bool> alive = m_accepting;
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (std::size_t i = 0; i < sets.size(); ++i)
+            {
+                if (alive[i])
+                    continue;
+
+                for (std::size_t characterClass = 0; characterClass < m_classCount; ++characterClass)
+                {
+                    const State target = m_transitions[i * m_classCount + characterClass];
+                    if ((target != Rejected) && alive[target])
+                    {
+                        alive[i] = true;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (auto& target : m_transitions)
+        {
+            if ((target != Rejected) && !alive[target])
+                target = Rejected;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextValidator::getCharacterClass(sf::Uint32 character) const
+    {
+        if (character < 128)
+            return m_asciiClasses[character];
+        else
+            return std::upper_bound(m_classBoundaries.begin(), m_classBoundaries.end(), character) - m_classBoundaries.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Texture.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <SFML/OpenGL.hpp>
 
@@ -64,7 +65,7 @@ namespace tgui
         sf::Transformable {copy},
         sf::Drawable      {copy},
         m_data            (copy.m_data),
-        m_vertices        (copy.m_vertices), // Did not compile in VS2013 when using braces
+        m_vertices        {copy.m_vertices},
         m_size            {copy.m_size},
         m_middleRect      {copy.m_middleRect},
         m_textureRect     {copy.m_textureRect},
@@ -120,7 +121,9 @@ namespace tgui
         if (m_loaded && (m_destructCallback != nullptr))
             m_destructCallback(getData());
 
+        // Don't reuse the data of the previous image, copies of this texture may still be using it
         m_loaded = false;
+        m_data = std::make_shared<TextureData>();
         if (!m_textureLoader(*this, id, partRect))
             throw Exception{"Failed to load '" + id + "'"};
 
@@ -204,8 +207,18 @@ namespace tgui
 
     void Texture::setColor(const sf::Color& color)
     {
+        if (m_vertexColor == color)
+            return;
+
         m_vertexColor = color;
-        for (auto& vertex : m_vertices)
+        if (!m_vertices)
+            return;
+
+        // Don't change the vertices of the copies that share them
+        if (m_vertices.use_count() > 1)
+            m_vertices = std::make_shared<std::vector<sf::Vertex>>(*m_vertices);
+
+        for (auto& vertex : *m_vertices)
             vertex.color = color;
     }
 
@@ -228,7 +241,7 @@ namespace tgui
 
     bool Texture::isTransparentPixel(float x, float y) const
     {
-        if (!m_data->image || (m_size.x == 0) || (m_size.y == 0))
+        if ((m_data->alphaMask.isEmpty() && !m_data->image) || (m_size.x == 0) || (m_size.y == 0))
             return false;
 
         assert((x >= getPosition().x) && (y >= getPosition().y) && (x < getPosition().x + getSize().x) && (y < getPosition().y + getSize().y));
@@ -312,6 +325,10 @@ namespace tgui
         };
 
         assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        if (!m_data->alphaMask.isEmpty())
+            return m_data->alphaMask.isTransparentPixel(pixel.x, pixel.y);
+
+        // Textures that weren't loaded by the texture manager may only have an image
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
         else
@@ -403,6 +420,12 @@ namespace tgui
         sf::Vector2f textureSize{m_data->texture.getSize()};
         sf::FloatRect middleRect{m_middleRect};
 
+        // The vertices may be shared with copies of this texture, in which case they are not changed but replaced
+        if (!m_vertices || (m_vertices.use_count() > 1))
+            m_vertices = std::make_shared<std::vector<sf::Vertex>>();
+
+        std::vector<sf::Vertex>& vertices = *m_vertices;
+
         // Calculate the vertices based on the way we are scaling
         switch (m_scalingType)
         {
@@ -412,11 +435,11 @@ namespace tgui
             // |   | //
             // 2---3 //
             ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(4);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Horizontal:
@@ -425,15 +448,15 @@ namespace tgui
             // |   |       |   | //
             // 1---3-------5---7 //
             ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(8);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
+            vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
+            vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Vertical:
@@ -448,15 +471,15 @@ namespace tgui
             // |   | //
             // 6---7-//
             ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(8);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
+            vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
+            vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::NineSlice:
@@ -471,29 +494,29 @@ namespace tgui
             // |    |              |     |  //
             // 6----7-------------8/20---21 //
             //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(22);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
+            vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
+            vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
+            vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
+            vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[9] = vertices[5];
+            vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
+            vertices[11] = vertices[3];
+            vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
+            vertices[13] = vertices[1];
+            vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[16] = vertices[12];
+            vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
+            vertices[18] = vertices[10];
+            vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[20] = vertices[8];
+            vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
     }
@@ -518,7 +541,8 @@ namespace tgui
             if (m_textureRect == sf::FloatRect(0, 0, 0, 0))
             {
                 states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                target.draw(m_vertices->data(), m_vertices->size(), sf::PrimitiveType::TrianglesStrip, states);
+                TGUI_PROFILE_DRAW_CALL(m_vertices->size());
             }
             else
             {
@@ -552,13 +576,16 @@ namespace tgui
 
                 // Set the clipping area
                 glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
+                TGUI_PROFILE_SCISSOR_CHANGE();
 
                 // Draw the texture
                 states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                target.draw(m_vertices->data(), m_vertices->size(), sf::PrimitiveType::TrianglesStrip, states);
+                TGUI_PROFILE_DRAW_CALL(m_vertices->size());
 
                 // Reset the old clipping area
                 glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                TGUI_PROFILE_SCISSOR_CHANGE();
             }
         }
     }
@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/TextureData.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AlphaMask::AlphaMask(const sf::Image& image, const sf::IntRect& rect, unsigned int maskScale) :
+        scale{std::max(1u, maskScale)}
+    {
+        const sf::Vector2u imageSize = image.getSize();
+
+        // Only use the part of the rect that lies inside the image
+        sf::IntRect area = rect;
+        if (area == sf::IntRect{})
+            area = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+        else if (!area.intersects({0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)}, area))
+            return;
+
+        size = {(static_cast<unsigned int>(area.width) + scale - 1) / scale, (static_cast<unsigned int>(area.height) + scale - 1) / scale};
+        wordsPerRow = (size.x + 31) / 32;
+        bits.resize(wordsPerRow * size.y, 0);
+
+        const sf::Uint8* pixels = image.getPixelsPtr();
+        for (unsigned int y = 0; y < static_cast<unsigned int>(area.height); ++y)
+        {
+            const sf::Uint8* alpha = pixels + 4 * ((area.top + y) * imageSize.x + area.left) + 3;
+            sf::Uint32* row = &bits[(y / scale) * wordsPerRow];
+            for (unsigned int x = 0; x < static_cast<unsigned int>(area.width); ++x, alpha += 4)
+            {
+                if (*alpha != 0)
+                    row[(x / scale) / 32] |= sf::Uint32{1} << ((x / scale) % 32);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,12 +26,138 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Start of every file in the image cache, the last character is the version of the format
+    const char imageCacheMagic[8] = {'T', 'G', 'U', 'I', 'I', 'M', 'G', '1'};
+
+    // The header is followed by the pixels in RGBA format, exactly as they are passed to sf::Image::create
+    struct ImageCacheHeader
+    {
+        char magic[8];
+        std::uint64_t hash;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // FNV-1a hash of the contents of a file, which changes when the image file is changed
+    bool hashFileContents(const std::string& filename, std::uint64_t& hash)
+    {
+        std::ifstream file{filename, std::ios::binary};
+        if (!file.is_open())
+            return false;
+
+        hash = 14695981039346656037ULL;
+        char buffer[4096];
+        while (file)
+        {
+            file.read(buffer, sizeof(buffer));
+            const std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i)
+            {
+                hash ^= static_cast<unsigned char>(buffer[i]);
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string makeImageCacheFilename(const std::string& directory, std::uint64_t hash)
+    {
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+        return directory + name + ".tguiimg";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Image> readCachedImage(const std::string& cacheFilename, std::uint64_t hash)
+    {
+        std::ifstream file{cacheFilename, std::ios::binary};
+        if (!file.is_open())
+            return nullptr;
+
+        ImageCacheHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+         || (std::memcmp(header.magic, imageCacheMagic, sizeof(imageCacheMagic)) != 0)
+         || (header.hash != hash)
+         || (header.width == 0) || (header.height == 0))
+        {
+            return nullptr;
+        }
+
+        // A file that was only partially written is ignored
+        std::vector<sf::Uint8> pixels(static_cast<std::size_t>(header.width) * header.height * 4);
+        if (!file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size())))
+            return nullptr;
+
+        auto image = std::make_shared<sf::Image>();
+        image->create(header.width, header.height, pixels.data());
+        return image;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeCachedImage(const std::string& cacheFilename, std::uint64_t hash, const sf::Image& image)
+    {
+        ImageCacheHeader header;
+        std::memcpy(header.magic, imageCacheMagic, sizeof(imageCacheMagic));
+        header.hash = hash;
+        header.width = image.getSize().x;
+        header.height = image.getSize().y;
+        if ((header.width == 0) || (header.height == 0))
+            return;
+
+        // The file is written under a temporary name first, so that another process never reads a half written file
+        const std::string temporaryFilename = cacheFilename + ".tmp";
+        {
+            std::ofstream file{temporaryFilename, std::ios::binary};
+            if (!file.is_open())
+                return;
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(image.getPixelsPtr()), static_cast<std::streamsize>(header.width) * header.height * 4);
+            if (!file)
+            {
+                file.close();
+                std::remove(temporaryFilename.c_str());
+                return;
+            }
+        }
+
+        if (std::rename(temporaryFilename.c_str(), cacheFilename.c_str()) != 0)
+            std::remove(temporaryFilename.c_str());
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    TextureManager::ImageMap TextureManager::m_imageMap;
+    std::map<const TextureData*, std::pair<TextureManager::ImageMap::iterator, std::list<TextureDataHolder>::iterator>> TextureManager::m_dataLocations;
+    unsigned int TextureManager::m_alphaMaskScale = 1;
+    bool TextureManager::m_keepImagesInMemory = true;
+    std::string TextureManager::m_imageCacheDirectory;
+    std::map<std::string, std::shared_ptr<sf::Image>> TextureManager::m_preloadedImages;
+    std::mutex TextureManager::m_preloadedImagesMutex;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -72,24 +198,64 @@ namespace tgui
         data.data = texture.getData();
         data.data->rect = partRect;
         imageIt->second.push_back(std::move(data));
+        m_dataLocations[texture.getData().get()] = {imageIt, std::prev(imageIt->second.end())};
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
         // Load the image
-        texture.getData()->image = texture.getImageLoader()(filename);
-        if (texture.getData()->image != nullptr)
+        TGUI_PROFILE_SCOPE("Texture", "load");
+        auto& textureData = *texture.getData();
+        {
+            // The preloaded image is handed over to the texture, so that it is released together with the texture data
+            std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+            auto preloadedIt = m_preloadedImages.find(filename);
+            if (preloadedIt != m_preloadedImages.end())
+            {
+                textureData.image = std::move(preloadedIt->second);
+                m_preloadedImages.erase(preloadedIt);
+            }
+        }
+
+        // Another part of the same image may still have the image in memory
+        if (!textureData.image)
+        {
+            for (auto& otherData : imageIt->second)
+            {
+                if (otherData.data->image)
+                {
+                    textureData.image = otherData.data->image;
+                    break;
+                }
+            }
+        }
+
+        if (!textureData.image)
+            textureData.image = loadImage(filename, texture.getImageLoader(), m_imageCacheDirectory);
+        if (textureData.image != nullptr)
         {
             // Create a texture from the image
+            bool loaded;
             if (partRect == sf::IntRect{})
-                return texture.getData()->texture.loadFromImage(*texture.getData()->image);
+                loaded = textureData.texture.loadFromImage(*textureData.image);
             else
-                return texture.getData()->texture.loadFromImage(*texture.getData()->image, partRect);
+                loaded = textureData.texture.loadFromImage(*textureData.image, partRect);
+
+            // Store which pixels are transparent, so that the image is no longer needed for hit testing
+            textureData.alphaMask = AlphaMask{*textureData.image, partRect, m_alphaMaskScale};
+            if (!m_keepImagesInMemory)
+                textureData.image = nullptr;
+
+            return loaded;
         }
 
         // The image could not be loaded
-        m_imageMap.erase(imageIt);
+        m_dataLocations.erase(texture.getData().get());
+        imageIt->second.pop_back();
+        if (imageIt->second.empty())
+            m_imageMap.erase(imageIt);
+
         return false;
     }
 
@@ -97,50 +263,139 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
-        {
-            for (auto& data : dataHolder.second)
-            {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
-            }
-        }
+        auto it = m_dataLocations.find(textureDataToCopy.get());
+        if (it == m_dataLocations.end())
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        // The texture is now used at multiple places
+        ++(it->second.second->users);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        auto it = m_dataLocations.find(textureDataToRemove.get());
+        if (it == m_dataLocations.end())
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        auto imageIt = it->second.first;
+        auto dataIt = it->second.second;
+        if (--(dataIt->users) == 0)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            m_dataLocations.erase(it);
+            imageIt->second.erase(dataIt);
+            if (imageIt->second.empty())
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
-
-                    return;
-                }
+                // Parts of the image will have to be loaded again from the file
+                std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+                m_preloadedImages.erase(imageIt->first);
+
+                m_imageMap.erase(imageIt);
             }
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAlphaMaskScale(unsigned int scale)
+    {
+        m_alphaMaskScale = std::max(1u, scale);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAlphaMaskScale()
+    {
+        return m_alphaMaskScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setKeepImagesInMemory(bool keepImages)
+    {
+        m_keepImagesInMemory = keepImages;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getKeepImagesInMemory()
+    {
+        return m_keepImagesInMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setImageCacheDirectory(const std::string& directory)
+    {
+        m_imageCacheDirectory = directory;
+        if (!m_imageCacheDirectory.empty() && (m_imageCacheDirectory.back() != '/') && (m_imageCacheDirectory.back() != '\\'))
+            m_imageCacheDirectory += '/';
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& TextureManager::getImageCacheDirectory()
+    {
+        return m_imageCacheDirectory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addPreloadedImage(const std::string& filename, std::shared_ptr<sf::Image> image)
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+        m_preloadedImages[filename] = std::move(image);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::hasPreloadedImage(const std::string& filename)
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+        return m_preloadedImages.find(filename) != m_preloadedImages.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::clearPreloadedImages()
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+        m_preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string TextureManager::getImageCacheFilename(const std::string& filename)
+    {
+        std::uint64_t hash;
+        if (m_imageCacheDirectory.empty() || !hashFileContents(filename, hash))
+            return "";
+
+        return makeImageCacheFilename(m_imageCacheDirectory, hash);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Image> TextureManager::loadImage(const std::string& filename,
+                                                         const std::function<std::shared_ptr<sf::Image>(const sf::String&)>& imageLoader,
+                                                         const std::string& cacheDirectory)
+    {
+        std::uint64_t hash;
+        if (cacheDirectory.empty() || !hashFileContents(filename, hash))
+            return imageLoader(filename);
+
+        const std::string cacheFilename = makeImageCacheFilename(cacheDirectory, hash);
+        auto image = readCachedImage(cacheFilename, hash);
+        if (image)
+            return image;
+
+        image = imageLoader(filename);
+        if (image)
+            writeCachedImage(cacheFilename, hash, *image);
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        return image;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,355 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Tween.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const float pi = 3.14159265358979f;
+
+    sf::Uint8 toColorComponent(float value)
+    {
+        return static_cast<sf::Uint8>(std::max(0.f, std::min(255.f, std::round(value))));
+    }
+
+    float bounceOut(float t)
+    {
+        if (t < 1 / 2.75f)
+            return 7.5625f * t * t;
+        else if (t < 2 / 2.75f)
+        {
+            t -= 1.5f / 2.75f;
+            return 7.5625f * t * t + 0.75f;
+        }
+        else if (t < 2.5f / 2.75f)
+        {
+            t -= 2.25f / 2.75f;
+            return 7.5625f * t * t + 0.9375f;
+        }
+        else
+        {
+            t -= 2.625f / 2.75f;
+            return 7.5625f * t * t + 0.984375f;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float applyEasing(Easing easing, float t)
+    {
+        switch (easing)
+        {
+            case Easing::Linear:
+                return t;
+
+            case Easing::QuadraticIn:
+                return t * t;
+
+            case Easing::QuadraticOut:
+                return t * (2 - t);
+
+            case Easing::QuadraticInOut:
+                if (t < 0.5f)
+                    return 2 * t * t;
+                else
+                    return 1 - 2 * (1 - t) * (1 - t);
+
+            case Easing::CubicIn:
+                return t * t * t;
+
+            case Easing::CubicOut:
+                return 1 - (1 - t) * (1 - t) * (1 - t);
+
+            case Easing::CubicInOut:
+                if (t < 0.5f)
+                    return 4 * t * t * t;
+                else
+                    return 1 - 4 * (1 - t) * (1 - t) * (1 - t);
+
+            case Easing::SineIn:
+                return 1 - std::cos(t * pi / 2);
+
+            case Easing::SineOut:
+                return std::sin(t * pi / 2);
+
+            case Easing::SineInOut:
+                return (1 - std::cos(t * pi)) / 2;
+
+            case Easing::BackOut:
+            {
+                const float overshoot = 1.70158f;
+                const float u = t - 1;
+                return 1 + u * u * ((overshoot + 1) * u + overshoot);
+            }
+
+            case Easing::BounceOut:
+                return bounceOut(t);
+        }
+
+        return t;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Tween(float start, float end, sf::Time duration, const std::function<void(float)>& setter, Easing easing) :
+        m_start     {start, 0, 0, 0},
+        m_end       {end, 0, 0, 0},
+        m_components{1},
+        m_duration  {duration},
+        m_easing    {easing},
+        m_setter    {[setter](const float* values){ setter(values[0]); }}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Tween(const Color& start, const Color& end, sf::Time duration, const std::function<void(const Color&)>& setter, Easing easing) :
+        m_components{4},
+        m_duration  {duration},
+        m_easing    {easing},
+        m_setter    {[setter](const float* values){ setter({toColorComponent(values[0]), toColorComponent(values[1]), toColorComponent(values[2]), toColorComponent(values[3])}); }}
+    {
+        const sf::Color startColor = start;
+        const sf::Color endColor = end;
+
+        m_start[0] = startColor.r;
+        m_start[1] = startColor.g;
+        m_start[2] = startColor.b;
+        m_start[3] = startColor.a;
+
+        m_end[0] = endColor.r;
+        m_end[1] = endColor.g;
+        m_end[2] = endColor.b;
+        m_end[3] = endColor.a;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Tween(const Borders& start, const Borders& end, sf::Time duration, const std::function<void(const Borders&)>& setter, Easing easing) :
+        m_start     {start.left, start.top, start.right, start.bottom},
+        m_end       {end.left, end.top, end.right, end.bottom},
+        m_components{4},
+        m_duration  {duration},
+        m_easing    {easing},
+        m_setter    {[setter](const float* values){ setter({values[0], values[1], values[2], values[3]}); }}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Timeline& Timeline::then(const Tween& tween)
+    {
+        m_groupStart = m_duration;
+        return with(tween);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Timeline& Timeline::with(const Tween& tween)
+    {
+        m_tweens.emplace_back(m_groupStart, tween);
+        m_duration = std::max(m_duration, m_groupStart + tween.getDuration());
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Timeline& Timeline::wait(sf::Time time)
+    {
+        m_duration += time;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::add(const Widget::Ptr& widget, const Tween& tween, sf::Time delay)
+    {
+        TweenState state;
+        std::copy(tween.m_start, tween.m_start + 4, state.start);
+        std::copy(tween.m_end, tween.m_end + 4, state.end);
+        state.components = tween.m_components;
+        state.easing = tween.m_easing;
+        state.delay = delay.asSeconds();
+        state.duration = tween.m_duration.asSeconds();
+        state.elapsed = 0;
+        state.finished = false;
+
+        if (m_updating)
+        {
+            m_newTweens.push_back({state, tween.m_setter, widget});
+        }
+        else
+        {
+            m_states.push_back(state);
+            m_setters.push_back(tween.m_setter);
+            m_widgets.push_back(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::add(const Widget::Ptr& widget, const Timeline& timeline, sf::Time delay)
+    {
+        for (auto& tween : timeline.m_tweens)
+            add(widget, tween.second, delay + tween.first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::stop(const Widget::Ptr& widget, bool finish)
+    {
+        for (std::size_t i = 0; i < m_states.size(); ++i)
+        {
+            if (!m_states[i].finished && (m_widgets[i].lock() == widget))
+            {
+                m_states[i].finished = true;
+                if (finish)
+                    apply(i, 1);
+            }
+        }
+
+        m_newTweens.erase(std::remove_if(m_newTweens.begin(), m_newTweens.end(),
+                                         [&widget](const NewTween& tween){ return tween.widget.lock() == widget; }),
+                          m_newTweens.end());
+
+        if (!m_updating)
+            removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::clear()
+    {
+        for (auto& state : m_states)
+            state.finished = true;
+
+        m_newTweens.clear();
+
+        if (!m_updating)
+            removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::update(sf::Time elapsedTime)
+    {
+        const float elapsedSeconds = elapsedTime.asSeconds();
+
+        m_updating = true;
+        for (std::size_t i = 0; i < m_states.size(); ++i)
+        {
+            TweenState& state = m_states[i];
+            if (state.finished)
+                continue;
+
+            state.elapsed += elapsedSeconds;
+            if (state.elapsed < state.delay)
+                continue;
+
+            if (state.elapsed >= state.delay + state.duration)
+            {
+                state.finished = true;
+                apply(i, 1);
+            }
+            else
+                apply(i, (state.elapsed - state.delay) / state.duration);
+        }
+        m_updating = false;
+
+        removeFinishedTweens();
+
+        for (auto& tween : m_newTweens)
+        {
+            m_states.push_back(tween.state);
+            m_setters.push_back(std::move(tween.setter));
+            m_widgets.push_back(std::move(tween.widget));
+        }
+        m_newTweens.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::apply(std::size_t index, float progress)
+    {
+        // The tween is dropped when the widget no longer exists
+        const Widget::Ptr widget = m_widgets[index].lock();
+        if (!widget)
+        {
+            m_states[index].finished = true;
+            return;
+        }
+
+        const TweenState& state = m_states[index];
+        const float factor = applyEasing(state.easing, progress);
+
+        float values[4];
+        for (unsigned int i = 0; i < state.components; ++i)
+            values[i] = state.start[i] + factor * (state.end[i] - state.start[i]);
+
+        m_setters[index](values);
+        widget->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tweener::removeFinishedTweens()
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < m_states.size(); ++i)
+        {
+            if (m_states[i].finished)
+                continue;
+
+            if (count != i)
+            {
+                m_states[count] = m_states[i];
+                m_setters[count] = std::move(m_setters[i]);
+                m_widgets[count] = std::move(m_widgets[i]);
+            }
+
+            ++count;
+        }
+
+        m_states.resize(count);
+        m_setters.resize(count);
+        m_widgets.resize(count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,7 +16,7 @@ namespace tgui
 
     VerticalLayout::Ptr VerticalLayout::create()
     {
-        return std::make_shared<VerticalLayout>();
+        return makePooled<VerticalLayout>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
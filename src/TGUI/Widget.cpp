@@ -190,6 +190,9 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
+        // The area where the widget was located has to be redrawn as well
+        invalidate();
+
         if (position.x.getImpl()->parentWidget != this)
         {
             position.x.getImpl()->parentWidget = this;
@@ -205,12 +208,17 @@ namespace tgui
 
         m_callback.position = getPosition();
         sendSignal("PositionChanged", getPosition());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setSize(const Layout2d& size)
     {
+        // The area where the widget was located has to be redrawn as well
+        invalidate();
+
         if (size.x.getImpl()->parentWidget != this)
         {
             size.x.getImpl()->parentWidget = this;
@@ -226,6 +234,8 @@ namespace tgui
 
         m_callback.size = getSize();
         sendSignal("SizeChanged", getSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,6 +253,7 @@ namespace tgui
     void Widget::show()
     {
         m_visible = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,12 +315,15 @@ namespace tgui
                 break;
             }
         }
+
+        scheduleUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::hide()
     {
+        invalidate();
         m_visible = false;
 
         // If the widget is focused then it must be unfocused
@@ -366,6 +380,8 @@ namespace tgui
                 break;
             }
         }
+
+        scheduleUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +389,7 @@ namespace tgui
     void Widget::enable()
     {
         m_enabled = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +405,8 @@ namespace tgui
 
         // If the widget is focused then it must be unfocused
         unfocus();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +436,8 @@ namespace tgui
             m_opacity = 1;
         else
             m_opacity = opacity;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,6 +475,7 @@ namespace tgui
     void Widget::setFont(const Font& font)
     {
         m_font = font.getFont();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,6 +487,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        invalidateArea({getPosition() - getWidgetOffset(), getFullSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateArea(const sf::FloatRect& area)
+    {
+        if (m_parent && m_visible)
+            m_parent->childInvalidated(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::detachTheme()
     {
         if (m_theme)
@@ -505,6 +542,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isUpdateRequired() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleUpdates()
+    {
+        if (m_parent && !m_updateScheduled)
+        {
+            m_updateScheduled = true;
+            m_parent->m_scheduledWidgets.push_back(shared_from_this());
+            m_parent->scheduleUpdates();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(float, float)
     {
     }
@@ -545,6 +601,7 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        invalidate();
         sendSignal("Focused");
 
         // Make sure the parent is also focused
@@ -556,6 +613,7 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        invalidate();
         sendSignal("Unfocused");
     }
 
@@ -601,6 +659,8 @@ namespace tgui
 
         if (m_theme && primary != "")
             m_theme->initWidget(this, primary, secondary);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -608,6 +668,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         sendSignal("MouseEntered");
     }
 
@@ -616,6 +677,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         sendSignal("MouseLeft");
     }
 
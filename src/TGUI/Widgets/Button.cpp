@@ -49,7 +49,7 @@ namespace tgui
 
     Button::Ptr Button::create(sf::String text)
     {
-        auto button = std::make_shared<Button>();
+        auto button = makePooled<Button>();
 
         if (!text.isEmpty())
             button->setText(text);
@@ -172,6 +172,8 @@ namespace tgui
         // Set the position of the text
         m_text.setPosition(getPosition().x + (getSize().x - m_text.getSize().x) * 0.5f,
                            getPosition().y + (getSize().y - m_text.getSize().y) * 0.5f);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -496,6 +498,8 @@ namespace tgui
 
         if (!m_button->m_mouseHover)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorNormal, m_button->getOpacity()));
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -506,6 +510,8 @@ namespace tgui
 
         if (m_button->m_mouseHover && !m_button->m_mouseDown)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorHover, m_button->getOpacity()));
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +522,8 @@ namespace tgui
 
         if (m_button->m_mouseHover && m_button->m_mouseDown)
             m_button->m_text.setTextColor(calcColorOpacity(m_textColorDown, m_button->getOpacity()));
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -532,6 +540,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,6 +549,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -546,6 +558,8 @@ namespace tgui
     void ButtonRenderer::setBackgroundColorDown(const Color& color)
     {
         m_backgroundColorDown = color;
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -553,6 +567,8 @@ namespace tgui
     void ButtonRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,6 +582,8 @@ namespace tgui
             m_textureNormal.setSize(m_button->getSize());
             m_textureNormal.setColor({m_textureNormal.getColor().r, m_textureNormal.getColor().g, m_textureNormal.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -579,6 +597,8 @@ namespace tgui
             m_textureHover.setSize(m_button->getSize());
             m_textureHover.setColor({m_textureHover.getColor().r, m_textureHover.getColor().g, m_textureHover.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,6 +612,8 @@ namespace tgui
             m_textureDown.setSize(m_button->getSize());
             m_textureDown.setColor({m_textureDown.getColor().r, m_textureDown.getColor().g, m_textureDown.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +627,16 @@ namespace tgui
             m_textureFocused.setSize(m_button->getSize());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_button->getOpacity() * 255)});
         }
+
+        m_button->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ButtonRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_button->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
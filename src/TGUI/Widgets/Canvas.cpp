@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/Canvas.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -48,7 +50,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(const Canvas& canvasToCopy) :
-        ClickableWidget{canvasToCopy}
+        ClickableWidget       {canvasToCopy},
+        m_keepContentsOnResize{canvasToCopy.m_keepContentsOnResize}
     {
         setSize(canvasToCopy.getSize());
     }
@@ -61,6 +64,7 @@ namespace tgui
         {
             ClickableWidget::operator=(right);
 
+            m_keepContentsOnResize = right.m_keepContentsOnResize;
             setSize(right.getSize());
         }
 
@@ -71,7 +75,7 @@ namespace tgui
 
     Canvas::Ptr Canvas::create(Layout2d size)
     {
-        return std::make_shared<Canvas>(size);
+        return makePooled<Canvas>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,11 +103,56 @@ namespace tgui
     {
         Widget::setSize(size);
 
-        m_renderTexture.create(static_cast<unsigned int>(getSize().x), static_cast<unsigned int>(getSize().y));
-        m_sprite.setTexture(m_renderTexture.getTexture(), true);
+        const sf::Vector2u newSize{std::max(1u, static_cast<unsigned int>(getSize().x)),
+                                   std::max(1u, static_cast<unsigned int>(getSize().y))};
 
-        m_renderTexture.clear();
-        m_renderTexture.display();
+        // The texture is only recreated when it is too small. It then grows by half of its size,
+        // so that a canvas that keeps getting a bit larger doesn't need a new texture every time.
+        const sf::Vector2u capacity = m_renderTexture.getSize();
+        if ((newSize.x > capacity.x) || (newSize.y > capacity.y))
+        {
+            const unsigned int maximumSize = sf::Texture::getMaximumSize();
+            sf::Vector2u newCapacity = capacity;
+            if (newSize.x > capacity.x)
+                newCapacity.x = std::min(maximumSize, std::max(newSize.x, capacity.x + capacity.x / 2));
+            if (newSize.y > capacity.y)
+                newCapacity.y = std::min(maximumSize, std::max(newSize.y, capacity.y + capacity.y / 2));
+
+            std::unique_ptr<sf::Texture> oldContents;
+            if (m_keepContentsOnResize && (capacity.x > 0) && (capacity.y > 0))
+                oldContents = std::unique_ptr<sf::Texture>(new sf::Texture(m_renderTexture.getTexture()));
+
+            m_renderTexture.create(newCapacity.x, newCapacity.y);
+            m_renderTexture.clear();
+
+            // Copy the pixels of the old texture, including their alpha value, to the top left of the new one
+            if (oldContents)
+                m_renderTexture.draw(sf::Sprite{*oldContents}, sf::RenderStates{sf::BlendNone});
+
+            m_renderTexture.display();
+        }
+        else if (!m_keepContentsOnResize)
+        {
+            m_renderTexture.clear();
+            m_renderTexture.display();
+        }
+
+        m_sprite.setTexture(m_renderTexture.getTexture());
+        m_sprite.setTextureRect({0, 0, static_cast<int>(newSize.x), static_cast<int>(newSize.y)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::setKeepContentsOnResize(bool keepContents)
+    {
+        m_keepContentsOnResize = keepContents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Canvas::getKeepContentsOnResize() const
+    {
+        return m_keepContentsOnResize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -132,6 +181,8 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
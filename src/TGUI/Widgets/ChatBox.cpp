@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -90,7 +91,7 @@ namespace tgui
 
     ChatBox::Ptr ChatBox::create()
     {
-        return std::make_shared<ChatBox>();
+        return makePooled<ChatBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,6 +183,8 @@ namespace tgui
 
         recalculateFullTextHeight();
         updateDisplayedText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +245,7 @@ namespace tgui
 
             recalculateFullTextHeight();
             updateDisplayedText();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -256,6 +260,8 @@ namespace tgui
 
         recalculateFullTextHeight();
         updateDisplayedText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,6 +604,8 @@ namespace tgui
 
     void ChatBox::recalculateLineText(Line& line)
     {
+        TGUI_PROFILE_SCOPE("Text", "ChatBox");
+
         line.text.setString("");
         line.sublines = 0;
 
@@ -962,6 +970,8 @@ namespace tgui
     void ChatBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        m_chatBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -969,6 +979,8 @@ namespace tgui
     void ChatBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        m_chatBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -981,6 +993,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_chatBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_chatBox->getOpacity() * 255)});
         }
+
+        m_chatBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -990,6 +1004,16 @@ namespace tgui
         WidgetPadding::setPadding(padding);
 
         m_chatBox->updateRendering();
+
+        m_chatBox->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_chatBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
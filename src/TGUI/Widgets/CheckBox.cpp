@@ -49,7 +49,7 @@ namespace tgui
 
     CheckBox::Ptr CheckBox::create(sf::String text)
     {
-        auto checkBox = std::make_shared<CheckBox>();
+        auto checkBox = makePooled<CheckBox>();
 
         if (!text.isEmpty())
             checkBox->setText(text);
@@ -78,6 +78,8 @@ namespace tgui
             m_callback.checked = true;
             sendSignal("Checked", static_cast<int>(m_checked));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +93,8 @@ namespace tgui
             m_callback.checked = false;
             sendSignal("Unchecked", static_cast<int>(m_checked));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,7 +75,7 @@ namespace tgui
 
     ChildWindow::Ptr ChildWindow::create()
     {
-        return std::make_shared<ChildWindow>();
+        return makePooled<ChildWindow>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -274,6 +274,8 @@ namespace tgui
 
         // Reposition the images and text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -875,7 +877,7 @@ namespace tgui
             if (value.empty() || toLower(value) == "default")
             {
                 m_closeButtonClassName = "";
-                m_childWindow->m_closeButton = std::make_shared<Button>();
+                m_childWindow->m_closeButton = makePooled<Button>();
             }
             else
             {
@@ -885,7 +887,7 @@ namespace tgui
                 ///       Temporarily load default close button in case it is attempted.
                 if (m_childWindow->getTheme() == nullptr)
                 {
-                    m_childWindow->m_closeButton = std::make_shared<Button>();
+                    m_childWindow->m_closeButton = makePooled<Button>();
                     return;
                 }
 
@@ -900,7 +902,7 @@ namespace tgui
             if (value.empty() || toLower(value) == "default")
             {
                 m_minimizeButtonClassName = "";
-                m_childWindow->m_minimizeButton = std::make_shared<Button>();
+                m_childWindow->m_minimizeButton = makePooled<Button>();
             }
             else
             {
@@ -910,7 +912,7 @@ namespace tgui
                 ///       Temporarily load default minimize button in case it is attempted.
                 if (m_childWindow->getTheme() == nullptr)
                 {
-                    m_childWindow->m_minimizeButton = std::make_shared<Button>();
+                    m_childWindow->m_minimizeButton = makePooled<Button>();
                     return;
                 }
 
@@ -925,7 +927,7 @@ namespace tgui
             if (value.empty() || toLower(value) == "default")
             {
                 m_maximizeButtonClassName = "";
-                m_childWindow->m_maximizeButton = std::make_shared<Button>();
+                m_childWindow->m_maximizeButton = makePooled<Button>();
             }
             else
             {
@@ -935,7 +937,7 @@ namespace tgui
                 ///       Temporarily load default minimize button in case it is attempted.
                 if (m_childWindow->getTheme() == nullptr)
                 {
-                    m_childWindow->m_maximizeButton = std::make_shared<Button>();
+                    m_childWindow->m_maximizeButton = makePooled<Button>();
                     return;
                 }
 
@@ -996,14 +998,14 @@ namespace tgui
                 m_closeButtonClassName = value.getString();
 
                 if (value.getString().isEmpty())
-                    m_childWindow->m_closeButton = std::make_shared<Button>();
+                    m_childWindow->m_closeButton = makePooled<Button>();
                 else
                 {
                     /// TODO: Widget files do not contain themes yet. This means that child window cannot be loaded from one.
                     ///       Temporarily load default close button in case it is attempted.
                     if (m_childWindow->getTheme() == nullptr)
                     {
-                        m_childWindow->m_closeButton = std::make_shared<Button>();
+                        m_childWindow->m_closeButton = makePooled<Button>();
                         return;
                     }
 
@@ -1016,14 +1018,14 @@ namespace tgui
                 m_minimizeButtonClassName = value.getString();
 
                 if (value.getString().isEmpty())
-                    m_childWindow->m_minimizeButton = std::make_shared<Button>();
+                    m_childWindow->m_minimizeButton = makePooled<Button>();
                 else
                 {
                     /// TODO: Widget files do not contain themes yet. This means that child window cannot be loaded from one.
                     ///       Temporarily load default minimize button in case it is attempted.
                     if (m_childWindow->getTheme() == nullptr)
                     {
-                        m_childWindow->m_minimizeButton = std::make_shared<Button>();
+                        m_childWindow->m_minimizeButton = makePooled<Button>();
                         return;
                     }
 
@@ -1036,14 +1038,14 @@ namespace tgui
                 m_maximizeButtonClassName = value.getString();
 
                 if (value.getString().isEmpty())
-                    m_childWindow->m_maximizeButton = std::make_shared<Button>();
+                    m_childWindow->m_maximizeButton = makePooled<Button>();
                 else
                 {
                     /// TODO: Widget files do not contain themes yet. This means that child window cannot be loaded from one.
                     ///       Temporarily load default maximize button in case it is attempted.
                     if (m_childWindow->getTheme() == nullptr)
                     {
-                        m_childWindow->m_maximizeButton = std::make_shared<Button>();
+                        m_childWindow->m_maximizeButton = makePooled<Button>();
                         return;
                     }
 
@@ -1106,6 +1108,8 @@ namespace tgui
     void ChildWindowRenderer::setTitleBarColor(const Color& color)
     {
         m_titleBarColor = color;
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1133,6 +1137,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1141,6 +1147,8 @@ namespace tgui
     {
         m_titleColor = color;
         m_childWindow->m_titleText.setTextColor(calcColorOpacity(m_titleColor, m_childWindow->getOpacity()));
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1148,6 +1156,8 @@ namespace tgui
     void ChildWindowRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1160,6 +1170,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1170,6 +1182,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1180,6 +1194,8 @@ namespace tgui
 
         // Reposition the images and text
         m_childWindow->updatePosition();
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1187,6 +1203,8 @@ namespace tgui
     void ChildWindowRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1202,6 +1220,8 @@ namespace tgui
         }
 
         setTitleBarHeight(m_titleBarHeight);
+
+        m_childWindow->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,7 +53,7 @@ namespace tgui
 
     ClickableWidget::Ptr ClickableWidget::create(Layout2d size)
     {
-        auto widget = std::make_shared<ClickableWidget>();
+        auto widget = makePooled<ClickableWidget>();
         widget->setSize(size);
         return widget;
     }
@@ -85,7 +85,7 @@ namespace tgui
 
     ComboBox::Ptr ComboBox::create()
     {
-        return std::make_shared<ComboBox>();
+        return makePooled<ComboBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,6 +195,7 @@ namespace tgui
         }
 
         // Add the item
+        invalidate();
         return m_listBox->addItem(item, id);
     }
 
@@ -204,6 +205,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -213,6 +215,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItemById(id);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -222,6 +225,7 @@ namespace tgui
     {
         bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -231,6 +235,8 @@ namespace tgui
     {
         m_text.setText("");
         m_listBox->deselectItem();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +254,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -266,6 +273,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -284,6 +292,7 @@ namespace tgui
             m_listBox->setSize({m_listBox->getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1)) + padding.top + padding.bottom});
         }
 
+        invalidate();
         return ret;
     }
 
@@ -297,6 +306,8 @@ namespace tgui
         // Shrink the list size
         Padding padding = m_listBox->getRenderer()->getScaledPadding();
         m_listBox->setSize({m_listBox->getSize().x, m_listBox->getItemHeight() + padding.top + padding.bottom});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +316,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -314,6 +326,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -323,6 +336,7 @@ namespace tgui
     {
         bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setText(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -679,7 +693,7 @@ namespace tgui
                 throw Exception{"Failed to load the internal list box, ComboBox has no connected theme to load the list box with"};
 
             if (toLower(value) == "default")
-                m_comboBox->m_listBox = std::make_shared<ListBox>();
+                m_comboBox->m_listBox = makePooled<ListBox>();
             else
             {
                 m_comboBox->m_listBox = m_comboBox->getTheme()->internalLoad(m_comboBox->getPrimaryLoadingParameter(),
@@ -750,7 +764,7 @@ namespace tgui
             if (property == "listbox")
             {
                 if (toLower(value.getString()) == "default")
-                    m_comboBox->m_listBox = std::make_shared<ListBox>();
+                    m_comboBox->m_listBox = makePooled<ListBox>();
                 else
                 {
                     if (m_comboBox->getTheme() == nullptr)
@@ -848,6 +862,8 @@ namespace tgui
     void ComboBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         getListBox()->setBackgroundColor(backgroundColor);
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -863,6 +879,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowBackgroundColorNormal(const Color& color)
     {
         m_arrowBackgroundColorNormal = color;
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -870,6 +888,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowBackgroundColorHover(const Color& color)
     {
         m_arrowBackgroundColorHover = color;
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -885,6 +905,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -892,6 +914,8 @@ namespace tgui
     void ComboBoxRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -900,6 +924,8 @@ namespace tgui
     {
         m_textColor = textColor;
         m_comboBox->m_text.setTextColor(calcColorOpacity(m_textColor, m_comboBox->getOpacity()));
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -907,6 +933,8 @@ namespace tgui
     void ComboBoxRenderer::setBorderColor(const Color& borderColor)
     {
         getListBox()->setBorderColor(borderColor);
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -920,6 +948,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_comboBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -936,6 +966,8 @@ namespace tgui
             m_textureArrowUpNormal.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowUpNormal.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowUpNormal.setColor({m_textureArrowUpNormal.getColor().r, m_textureArrowUpNormal.getColor().g, m_textureArrowUpNormal.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -952,6 +984,8 @@ namespace tgui
             m_textureArrowDownNormal.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowDownNormal.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowDownNormal.setColor({m_textureArrowDownNormal.getColor().r, m_textureArrowDownNormal.getColor().g, m_textureArrowDownNormal.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -968,6 +1002,8 @@ namespace tgui
             m_textureArrowUpHover.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowUpHover.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowUpHover.setColor({m_textureArrowUpHover.getColor().r, m_textureArrowUpHover.getColor().g, m_textureArrowUpHover.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -984,6 +1020,8 @@ namespace tgui
             m_textureArrowDownHover.setPosition({m_comboBox->getPosition().x + m_comboBox->getSize().x - m_textureArrowDownHover.getSize().x - padding.right, m_comboBox->getPosition().y + padding.top});
             m_textureArrowDownHover.setColor({m_textureArrowDownHover.getColor().r, m_textureArrowDownHover.getColor().g, m_textureArrowDownHover.getColor().b, static_cast<sf::Uint8>(m_comboBox->getOpacity() * 255)});
         }
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -992,6 +1030,8 @@ namespace tgui
     {
         WidgetBorders::setBorders(borders);
         getListBox()->setBorders({m_borders.left, 0, m_borders.right, m_borders.bottom});
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1000,6 +1040,8 @@ namespace tgui
     {
         WidgetPadding::setPadding(padding);
         m_comboBox->updateSize();
+
+        m_comboBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
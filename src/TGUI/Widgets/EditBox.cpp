@@ -28,7 +28,9 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +56,9 @@ namespace tgui
 
         m_defaultText.setStyle(sf::Text::Italic);
 
+        // The empty text doesn't have any vertices
+        m_characterVertices.push_back(0);
+
         m_caret.setSize({1, 0});
 
         m_renderer = std::make_shared<EditBoxRenderer>(this);
@@ -66,7 +71,7 @@ namespace tgui
 
     EditBox::Ptr EditBox::create()
     {
-        return std::make_shared<EditBox>();
+        return makePooled<EditBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,13 +134,7 @@ namespace tgui
         Widget::setFont(font);
 
         if (font.getFont())
-        {
-            m_textBeforeSelection.setFont(*font.getFont());
-            m_textSelection.setFont(*font.getFont());
-            m_textAfterSelection.setFont(*font.getFont());
-            m_textFull.setFont(*font.getFont());
             m_defaultText.setFont(*font.getFont());
-        }
 
         // Recalculate the text size and position
         setText(m_text);
@@ -147,30 +146,20 @@ namespace tgui
     {
         // Check if the text is auto sized
         if (m_textSize == 0)
-        {
-            m_textFull.setCharacterSize(findBestTextSize(getFont(), (getSize().y - getRenderer()->getScaledPadding().bottom - getRenderer()->getScaledPadding().top) * 0.85f));
-            m_textBeforeSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_textSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_textAfterSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_defaultText.setCharacterSize(m_textFull.getCharacterSize());
-        }
+            m_characterSize = findBestTextSize(getFont(), (getSize().y - getRenderer()->getScaledPadding().bottom - getRenderer()->getScaledPadding().top) * 0.85f);
         else // When the text has a fixed size
-        {
-            m_textFull.setCharacterSize(m_textSize);
-            m_textBeforeSelection.setCharacterSize(m_textSize);
-            m_textSelection.setCharacterSize(m_textSize);
-            m_textAfterSelection.setCharacterSize(m_textSize);
-            m_defaultText.setCharacterSize(m_textSize);
-        }
+            m_characterSize = m_textSize;
+
+        m_defaultText.setCharacterSize(m_characterSize);
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        if (m_validator.matches(text))
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
         else // Clear the text
             m_text = "";
 
+        textChangedAt(0);
+
         m_displayedText = m_text;
 
         // If there is a character limit then check if it is exeeded
@@ -178,6 +167,7 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            textChangedAt(m_maxChars);
             m_displayedText.erase(m_maxChars, sf::String::InvalidPos);
         }
 
@@ -189,11 +179,8 @@ namespace tgui
                 m_displayedText[i] = m_passwordChar;
         }
 
-        // Set the texts
-        m_textBeforeSelection.setString(m_displayedText);
-        m_textSelection.setString("");
-        m_textAfterSelection.setString("");
-        m_textFull.setString(m_displayedText);
+        // The font or text size might have changed as well, so all glyphs are recreated
+        updateTextGeometry(0);
 
         float width = getVisibleEditBoxWidth();
 
@@ -201,23 +188,19 @@ namespace tgui
         if (m_limitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            while (m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x > width)
+            while (getTextWidth() > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_text.erase(m_text.getSize()-1);
+                textChangedAt(m_text.getSize());
                 m_displayedText.erase(m_displayedText.getSize()-1);
-
-                // Set the new text
-                m_textBeforeSelection.setString(m_displayedText);
+                updateTextGeometry(m_displayedText.getSize());
             }
-
-            // Set the full text again
-            m_textFull.setString(m_displayedText);
         }
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = getTextWidth();
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -231,6 +214,8 @@ namespace tgui
 
         // Set the caret behind the last character
         setCaretPosition(m_displayedText.getSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,13 +271,11 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            textChangedAt(m_maxChars);
             m_displayedText.erase(m_maxChars, sf::String::InvalidPos);
 
             // If we passed here then the text has changed.
-            m_textBeforeSelection.setString(m_displayedText);
-            m_textSelection.setString("");
-            m_textAfterSelection.setString("");
-            m_textFull.setString(m_displayedText);
+            updateTextGeometry(m_maxChars);
 
             // Set the caret behind the last character
             setCaretPosition(m_displayedText.getSize());
@@ -318,17 +301,15 @@ namespace tgui
         {
             // Now check if the text fits into the EditBox
             float width = getVisibleEditBoxWidth();
-            while (m_textBeforeSelection.findCharacterPos(m_displayedText.getSize()).x - m_textBeforeSelection.getPosition().x > width)
+            while (getTextWidth() > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_text.erase(m_text.getSize()-1);
+                textChangedAt(m_text.getSize());
                 m_displayedText.erase(m_displayedText.getSize()-1);
-                m_textBeforeSelection.setString(m_displayedText);
+                updateTextGeometry(m_displayedText.getSize());
             }
 
-            // The full text might have changed
-            m_textFull.setString(m_displayedText);
-
             // There is no clipping
             m_textCropPosition = 0;
 
@@ -351,20 +332,14 @@ namespace tgui
         m_selStart = charactersBeforeCaret;
         m_selEnd = charactersBeforeCaret;
 
-        // Change our texts
-        m_textBeforeSelection.setString(m_displayedText);
-        m_textSelection.setString("");
-        m_textAfterSelection.setString("");
-        m_textFull.setString(m_displayedText);
-
         // Check if scrolling is enabled
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            float caretPosition = m_characterOffsets.getOffset(m_selEnd);
 
             if (m_selEnd == m_displayedText.getSize())
-                caretPosition += m_textFull.getCharacterSize() / 10.f;
+                caretPosition += m_characterSize / 10.f;
 
             // If the caret is too far on the right then adjust the cropping
             if (m_textCropPosition + getVisibleEditBoxWidth() < caretPosition)
@@ -397,8 +372,8 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
-        m_regexString = regex;
-        m_regex = m_regexString;
+        m_validator = TextValidator{regex};
+        m_validatorStates.clear();
 
         setText(m_text);
     }
@@ -407,7 +382,7 @@ namespace tgui
 
     const std::string& EditBox::getInputValidator()
     {
-        return m_regexString;
+        return m_validator.getPattern();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,10 +393,6 @@ namespace tgui
         m_selEnd = m_text.getSize();
         m_selChars = m_text.getSize();
 
-        m_textBeforeSelection.setString("");
-        m_textSelection.setString(m_displayedText);
-        m_textAfterSelection.setString("");
-
         recalculateTextPositions();
     }
 
@@ -435,17 +406,11 @@ namespace tgui
         getRenderer()->m_textureHover.setColor({getRenderer()->m_textureHover.getColor().r, getRenderer()->m_textureHover.getColor().g, getRenderer()->m_textureHover.getColor().b, static_cast<sf::Uint8>(m_opacity * 255)});
         getRenderer()->m_textureFocused.setColor({getRenderer()->m_textureFocused.getColor().r, getRenderer()->m_textureFocused.getColor().g, getRenderer()->m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_opacity * 255)});
 
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_textBeforeSelection.setFillColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-        m_textAfterSelection.setFillColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-        m_textSelection.setFillColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
+        updateTextColor();
         m_selectedTextBackground.setFillColor(calcColorOpacity(getRenderer()->m_selectedTextBackgroundColor, getOpacity()));
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_defaultText.setFillColor(calcColorOpacity(getRenderer()->m_defaultTextColor, getOpacity()));
 #else
-        m_textBeforeSelection.setColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-        m_textAfterSelection.setColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-        m_textSelection.setColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
-        m_selectedTextBackground.setFillColor(calcColorOpacity(getRenderer()->m_selectedTextBackgroundColor, getOpacity()));
         m_defaultText.setColor(calcColorOpacity(getRenderer()->m_defaultTextColor, getOpacity()));
 #endif
         m_caret.setFillColor(calcColorOpacity(getRenderer()->m_caretColor, getOpacity()));
@@ -488,11 +453,6 @@ namespace tgui
             m_selStart = 0;
             m_selEnd = m_text.getSize();
             m_selChars = m_text.getSize();
-
-            // Change the texts
-            m_textBeforeSelection.setString("");
-            m_textSelection.setString(m_displayedText);
-            m_textAfterSelection.setString("");
         }
         else // No double clicking
         {
@@ -543,10 +503,10 @@ namespace tgui
                 if (x - getPosition().x < getRenderer()->getScaledPadding().left)
                 {
                     // Move the text by a few pixels
-                    if (m_textFull.getCharacterSize() > 10)
+                    if (m_characterSize > 10)
                     {
-                        if (m_textCropPosition > m_textFull.getCharacterSize() / 10)
-                            m_textCropPosition -= static_cast<unsigned int>(std::floor(m_textFull.getCharacterSize() / 10.f + 0.5f));
+                        if (m_textCropPosition > m_characterSize / 10)
+                            m_textCropPosition -= static_cast<unsigned int>(std::floor(m_characterSize / 10.f + 0.5f));
                         else
                             m_textCropPosition = 0;
                     }
@@ -557,19 +517,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > getRenderer()->getScaledPadding().left + width) && (m_textFull.findCharacterPos(m_displayedText.getSize()).x > width))
+                else if ((x - getPosition().x > getRenderer()->getScaledPadding().left + width) && (getTextWidth() > width))
                 {
                     // Move the text by a few pixels
-                    if (m_textFull.getCharacterSize() > 10)
+                    if (m_characterSize > 10)
                     {
-                        if (m_textCropPosition + width < m_textFull.findCharacterPos(m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10))
-                            m_textCropPosition += static_cast<unsigned int>(std::floor(m_textFull.getCharacterSize() / 10.f + 0.5f));
+                        if (m_textCropPosition + width < getTextWidth() + (m_characterSize / 10))
+                            m_textCropPosition += static_cast<unsigned int>(std::floor(m_characterSize / 10.f + 0.5f));
                         else
-                            m_textCropPosition = static_cast<unsigned int>(m_textFull.findCharacterPos(m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10) - width);
+                            m_textCropPosition = static_cast<unsigned int>(getTextWidth() + (m_characterSize / 10) - width);
                     }
                     else
                     {
-                        if (m_textCropPosition + width < m_textFull.findCharacterPos(m_displayedText.getSize()).x)
+                        if (m_textCropPosition + width < getTextWidth())
                             ++m_textCropPosition;
                     }
                 }
@@ -587,11 +547,6 @@ namespace tgui
                     // Adjust the number of characters that are selected
                     m_selChars = m_selEnd - m_selStart;
 
-                    // Change our three texts
-                    m_textBeforeSelection.setString(m_displayedText.toWideString().substr(0, m_selStart));
-                    m_textSelection.setString(m_displayedText.toWideString().substr(m_selStart, m_selChars));
-                    m_textAfterSelection.setString(m_displayedText.toWideString().substr(m_selEnd));
-
                     recalculateTextPositions();
                 }
             }
@@ -603,11 +558,6 @@ namespace tgui
                     // Adjust the number of characters that are selected
                     m_selChars = m_selStart - m_selEnd;
 
-                    // Change our three texts
-                    m_textBeforeSelection.setString(m_displayedText.toWideString().substr(0, m_selEnd));
-                    m_textSelection.setString(m_displayedText.toWideString().substr(m_selEnd, m_selChars));
-                    m_textAfterSelection.setString(m_displayedText.toWideString().substr(m_selStart));
-
                     recalculateTextPositions();
                 }
             }
@@ -616,11 +566,6 @@ namespace tgui
                 // Adjust the number of characters that are selected
                 m_selChars = 0;
 
-                // Change our three texts
-                m_textBeforeSelection.setString(m_displayedText);
-                m_textSelection.setString("");
-                m_textAfterSelection.setString("");
-
                 recalculateTextPositions();
             }
         }
@@ -709,7 +654,9 @@ namespace tgui
 
                 // Erase the character
                 m_text.erase(m_selEnd-1, 1);
+                textChangedAt(m_selEnd-1);
                 m_displayedText.erase(m_selEnd-1, 1);
+                updateTextGeometry(m_selEnd-1);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd - 1);
@@ -717,7 +664,7 @@ namespace tgui
                 float width = getVisibleEditBoxWidth();
 
                 // Calculate the text width
-                float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+                float textWidth = getTextWidth();
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -749,13 +696,15 @@ namespace tgui
 
                 // Erase the character
                 m_text.erase(m_selEnd, 1);
+                textChangedAt(m_selEnd);
                 m_displayedText.erase(m_selEnd, 1);
+                updateTextGeometry(m_selEnd);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd);
 
                 // Calculate the text width
-                float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+                float textWidth = getTextWidth();
 
                 // If the text can be moved to the right then do so
                 float width = getVisibleEditBoxWidth();
@@ -784,7 +733,7 @@ namespace tgui
             {
                 if (event.code == sf::Keyboard::C)
                 {
-                    Clipboard::set(m_textSelection.getString());
+                    Clipboard::set(m_displayedText.substring(std::min(m_selStart, m_selEnd), m_selChars));
                 }
                 else if (event.code == sf::Keyboard::V)
                 {
@@ -810,7 +759,7 @@ namespace tgui
                 }
                 else if (event.code == sf::Keyboard::X)
                 {
-                    Clipboard::set(m_textSelection.getString());
+                    Clipboard::set(m_displayedText.substring(std::min(m_selStart, m_selEnd), m_selChars));
                     deleteSelectedCharacters();
 
                     m_callback.text = m_text;
@@ -828,14 +777,15 @@ namespace tgui
 
     void EditBox::textEntered(sf::Uint32 key)
     {
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
+        // Only add the character when the regex matches.
+        // The states of the text before the caret are remembered, so typing at the end only has to check the new character.
+        if (!m_validator.acceptsEverything())
         {
-            sf::String text = m_text;
-            text.insert(m_selEnd, key);
+            TextValidator::State state = m_validator.next(getValidatorState(m_selEnd), key);
+            for (std::size_t i = m_selEnd; (i < m_text.getSize()) && (state != TextValidator::Rejected); ++i)
+                state = m_validator.next(state, m_text[i]);
 
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
+            if (!m_validator.isAccepting(state))
                 return;
         }
 
@@ -849,6 +799,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        textChangedAt(m_selEnd);
 
         // Change the displayed text
         if (m_passwordChar != '\0')
@@ -856,18 +807,20 @@ namespace tgui
         else
             m_displayedText.insert(m_selEnd, key);
 
-        // Append the character to the text
-        m_textFull.setString(m_displayedText);
+        // Only the glyphs starting from the new character have to be created
+        updateTextGeometry(m_selEnd);
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_textFull.findCharacterPos(m_displayedText.getSize()).x > getVisibleEditBoxWidth())
+            if (getTextWidth() > getVisibleEditBoxWidth())
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
                 m_displayedText.erase(m_selEnd, 1);
+                textChangedAt(m_selEnd);
+                updateTextGeometry(m_selEnd);
                 return;
             }
         }
@@ -892,6 +845,9 @@ namespace tgui
     #endif
 
         Widget::widgetFocused();
+
+        // The caret has to blink while the widget is focused
+        scheduleUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -913,20 +869,11 @@ namespace tgui
 
     void EditBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_textBeforeSelection.setFillColor({0, 0, 0});
-        m_textSelection.setFillColor({255, 255, 255});
-        m_textAfterSelection.setFillColor({0, 0, 0});
-        m_defaultText.setFillColor({160, 160, 160});
-#else
-        m_textBeforeSelection.setColor({0, 0, 0});
-        m_textSelection.setColor({255, 255, 255});
-        m_textAfterSelection.setColor({0, 0, 0});
-        m_defaultText.setColor({160, 160, 160});
-#endif
-        m_caret.setFillColor({0, 0, 0});
-        m_selectedTextBackground.setFillColor({0, 110, 255});
-
+        getRenderer()->setTextColor({0, 0, 0});
+        getRenderer()->setSelectedTextColor({255, 255, 255});
+        getRenderer()->setSelectedTextBackgroundColor({0, 110, 255});
+        getRenderer()->setDefaultTextColor({160, 160, 160});
+        getRenderer()->setCaretColor({0, 0, 0});
         getRenderer()->setBorders({2, 2, 2, 2});
         getRenderer()->setPadding({4, 2, 4, 2});
         getRenderer()->setBorderColor({0, 0, 0});
@@ -974,7 +921,7 @@ namespace tgui
         if (m_textAlignment != Alignment::Left)
         {
             float editBoxWidth = getVisibleEditBoxWidth();
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = getTextWidth();
 
             if (textWidth < editBoxWidth)
             {
@@ -986,44 +933,7 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        sf::Uint32 prevChar = 0;
-        unsigned int textSize = getTextSize();
-        bool bold = false; /// TODO: (getRenderer()->getTextStyle() & sf::Text::Bold) != 0;
-
-        std::size_t index;
-        for (index = 0; index < m_text.getSize(); ++index)
-        {
-            float charWidth;
-            sf::Uint32 curChar = m_text[index];
-            if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(getFont()->getGlyph(' ', textSize, bold).advance) * 4;
-            else
-                charWidth = static_cast<float>(getFont()->getGlyph(curChar, textSize, bold).advance);
-
-            float kerning = static_cast<float>(getFont()->getKerning(prevChar, curChar, textSize));
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
-            {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
-
-                break;
-            }
-
-            prevChar = curChar;
-        }
-
-        return index;
+        return m_characterOffsets.findCaretPosition(posX);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1039,7 +949,9 @@ namespace tgui
         {
             // Erase the characters
             m_text.erase(m_selStart, m_selChars);
+            textChangedAt(m_selStart);
             m_displayedText.erase(m_selStart, m_selChars);
+            updateTextGeometry(m_selStart);
 
             // Set the caret back on the correct position
             setCaretPosition(m_selStart);
@@ -1048,14 +960,16 @@ namespace tgui
         {
             // Erase the characters
             m_text.erase(m_selEnd, m_selChars);
+            textChangedAt(m_selEnd);
             m_displayedText.erase(m_selEnd, m_selChars);
+            updateTextGeometry(m_selEnd);
 
             // Set the caret back on the correct position
             setCaretPosition(m_selEnd);
         }
 
         // Calculate the text width
-        float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+        float textWidth = getTextWidth();
 
         // If the text can be moved to the right then do so
         float width = getVisibleEditBoxWidth();
@@ -1070,6 +984,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TextValidator::State EditBox::getValidatorState(std::size_t length)
+    {
+        if (m_validatorStates.empty())
+            m_validatorStates.push_back(m_validator.getStartState());
+
+        while (m_validatorStates.size() <= length)
+            m_validatorStates.push_back(m_validator.next(m_validatorStates.back(), m_text[m_validatorStates.size() - 1]));
+
+        return m_validatorStates[length];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::textChangedAt(std::size_t position)
+    {
+        if (m_validatorStates.size() > position + 1)
+            m_validatorStates.resize(position + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         Padding padding = getRenderer()->getScaledPadding();
@@ -1086,7 +1021,7 @@ namespace tgui
         if (m_textAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = getTextWidth();
 
             // Check if a layout would make sense
             if (textWidth < getVisibleEditBoxWidth())
@@ -1099,41 +1034,154 @@ namespace tgui
             }
         }
 
-        float caretLeft = textX;
-
-        // Set the text before the selection on the correct position
-        m_textBeforeSelection.setPosition(std::floor(textX + 0.5f), textY);
-        m_defaultText.setPosition(std::floor(textX + 0.5f), textY);
+        // Set the text on the correct position
+        m_textPosition = {std::floor(textX + 0.5f), textY};
+        m_defaultText.setPosition(m_textPosition);
 
         // Check if there is a selection
         if (m_selChars != 0)
         {
-            // Watch out for the kerning
-            if (m_textBeforeSelection.getString().getSize() > 0)
-                textX += m_font->getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+            const std::size_t selectionFirst = std::min({m_selStart, m_selEnd, m_displayedText.getSize()});
+            const std::size_t selectionLast = std::min(std::max(m_selStart, m_selEnd), m_displayedText.getSize());
 
-            textX += m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x;
+            // The background starts where the first selected glyph starts, so after the kerning with the character in front of it
+            float selectionLeft = m_characterOffsets.getOffset(selectionFirst);
+            if ((selectionFirst > 0) && getFont())
+                selectionLeft += getFont()->getKerning(m_displayedText[selectionFirst - 1], m_displayedText[selectionFirst], m_characterSize);
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x - m_textSelection.getPosition().x,
-                                              getSize().y - padding.top - padding.bottom});
-            m_selectedTextBackground.setPosition(std::floor(textX + 0.5f), std::floor(getPosition().y + padding.top + 0.5f));
+            m_selectedTextBackground.setSize({m_characterOffsets.getOffset(selectionLast) - selectionLeft, getSize().y - padding.top - padding.bottom});
+            m_selectedTextBackground.setPosition(std::floor(textX + selectionLeft + 0.5f), std::floor(getPosition().y + padding.top + 0.5f));
+        }
 
-            // Set the text selected text on the correct position
-            m_textSelection.setPosition(std::floor(textX + 0.5f), textY);
+        // The selected characters are drawn in a different color
+        updateSelectionColor();
 
-            // Watch out for kerning
-            if (m_displayedText.getSize() > m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize())
-                textX += m_font->getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+        // Set the position of the caret
+        float caretLeft = textX + m_characterOffsets.getOffset(m_selEnd) - (m_caret.getSize().x * 0.5f);
+        m_caret.setPosition(std::floor(caretLeft + 0.5f), std::floor(padding.top + getPosition().y + 0.5f));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x  - m_textSelection.getPosition().x;
-            m_textAfterSelection.setPosition(std::floor(textX + 0.5f), textY);
+    void EditBox::updateTextGeometry(std::size_t firstChangedCharacter)
+    {
+        TGUI_PROFILE_SCOPE("Text", "EditBox");
+
+        // Remove the glyphs of the changed characters, the offset of the first changed character remains valid
+        firstChangedCharacter = std::min({firstChangedCharacter, m_displayedText.getSize(), m_characterOffsets.getCharacterCount()});
+        m_textVertices.resize(m_characterVertices[firstChangedCharacter]);
+        m_characterOffsets.truncate(firstChangedCharacter);
+        m_characterVertices.resize(firstChangedCharacter + 1);
+
+        // The new glyphs get the normal text color, only the selected characters in front of the change keep their color
+        m_coloredSelectionLast = std::min(m_coloredSelectionLast, firstChangedCharacter);
+        m_coloredSelectionFirst = std::min(m_coloredSelectionFirst, m_coloredSelectionLast);
+
+        const auto font = getFont();
+        if (!font)
+        {
+            for (std::size_t i = firstChangedCharacter; i < m_displayedText.getSize(); ++i)
+                m_characterOffsets.addCharacter(0);
+
+            m_characterVertices.resize(m_displayedText.getSize() + 1, 0);
+            return;
         }
 
-        // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
-        m_caret.setPosition(std::floor(caretLeft + 0.5f), std::floor(padding.top + getPosition().y + 0.5f));
+        // Create the glyphs in the same way as sf::Text does
+        const sf::Color color = calcColorOpacity(getRenderer()->m_textColor, getOpacity());
+        const float whitespaceWidth = static_cast<float>(font->getGlyph(' ', m_characterSize, false).advance);
+        const float y = static_cast<float>(m_characterSize);
+
+        float x = m_characterOffsets.getWidth();
+        sf::Uint32 prevChar = (firstChangedCharacter > 0) ? m_displayedText[firstChangedCharacter - 1] : 0;
+        for (std::size_t i = firstChangedCharacter; i < m_displayedText.getSize(); ++i)
+        {
+            const sf::Uint32 curChar = m_displayedText[i];
+            x += static_cast<float>(font->getKerning(prevChar, curChar, m_characterSize));
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar != '\n')
+            {
+                const sf::Glyph& glyph = font->getGlyph(curChar, m_characterSize, false);
+
+                const float left = x + glyph.bounds.left;
+                const float top = y + glyph.bounds.top;
+                const float right = left + glyph.bounds.width;
+                const float bottom = top + glyph.bounds.height;
+
+                const float texLeft = static_cast<float>(glyph.textureRect.left);
+                const float texTop = static_cast<float>(glyph.textureRect.top);
+                const float texRight = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+                const float texBottom = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+                m_textVertices.emplace_back(sf::Vector2f{left, top}, color, sf::Vector2f{texLeft, texTop});
+                m_textVertices.emplace_back(sf::Vector2f{right, top}, color, sf::Vector2f{texRight, texTop});
+                m_textVertices.emplace_back(sf::Vector2f{left, bottom}, color, sf::Vector2f{texLeft, texBottom});
+                m_textVertices.emplace_back(sf::Vector2f{left, bottom}, color, sf::Vector2f{texLeft, texBottom});
+                m_textVertices.emplace_back(sf::Vector2f{right, top}, color, sf::Vector2f{texRight, texTop});
+                m_textVertices.emplace_back(sf::Vector2f{right, bottom}, color, sf::Vector2f{texRight, texBottom});
+
+                x += static_cast<float>(glyph.advance);
+            }
+
+            m_characterOffsets.addCharacter(x);
+            m_characterVertices.push_back(m_textVertices.size());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float EditBox::getTextWidth() const
+    {
+        return m_characterOffsets.getWidth();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateTextColor()
+    {
+        m_coloredSelectionFirst = 0;
+        m_coloredSelectionLast = 0;
+        setCharacterColor(0, m_characterVertices.size() - 1, calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
+
+        updateSelectionColor();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateSelectionColor()
+    {
+        // The selection might temporarily lie outside the text while the text is being changed
+        const std::size_t selectionFirst = std::min({m_selStart, m_selEnd, m_characterVertices.size() - 1});
+        const std::size_t selectionLast = std::min(std::max(m_selStart, m_selEnd), m_characterVertices.size() - 1);
+
+        // Moving the caret or extending the selection only changes the color of the characters between the old and new bounds
+        const sf::Color textColor = calcColorOpacity(getRenderer()->m_textColor, getOpacity());
+        setCharacterColor(m_coloredSelectionFirst, std::min(m_coloredSelectionLast, selectionFirst), textColor);
+        setCharacterColor(std::max(m_coloredSelectionFirst, selectionLast), m_coloredSelectionLast, textColor);
+
+        const sf::Color selectedTextColor = calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity());
+        setCharacterColor(selectionFirst, std::min(selectionLast, m_coloredSelectionFirst), selectedTextColor);
+        setCharacterColor(std::max(selectionFirst, m_coloredSelectionLast), selectionLast, selectedTextColor);
+
+        m_coloredSelectionFirst = selectionFirst;
+        m_coloredSelectionLast = selectionLast;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::setCharacterColor(std::size_t first, std::size_t last, const sf::Color& color)
+    {
+        if (first >= last)
+            return;
+
+        for (std::size_t i = m_characterVertices[first]; i < m_characterVertices[last]; ++i)
+            m_textVertices[i].color = color;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1151,6 +1199,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -1158,6 +1210,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || m_focused || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Draw the background
@@ -1167,16 +1226,18 @@ namespace tgui
         Padding padding = getRenderer()->getScaledPadding();
         Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
 
-        if ((m_textBeforeSelection.getString() != "") || (m_textSelection.getString() != ""))
+        if (!m_displayedText.isEmpty())
         {
-            target.draw(m_textBeforeSelection, states);
-
-            if (m_textSelection.getString() != "")
-            {
+            if (m_selChars != 0)
                 target.draw(m_selectedTextBackground, states);
 
-                target.draw(m_textSelection, states);
-                target.draw(m_textAfterSelection, states);
+            if (!m_textVertices.empty() && getFont())
+            {
+                sf::RenderStates textStates = states;
+                textStates.transform.translate(m_textPosition);
+                textStates.texture = &getFont()->getTexture(m_characterSize);
+                target.draw(m_textVertices.data(), m_textVertices.size(), sf::Triangles, textStates);
+                TGUI_PROFILE_DRAW_CALL(m_textVertices.size());
             }
         }
         else if (m_defaultText.getString() != "")
@@ -1372,6 +1433,8 @@ namespace tgui
         // Set the size of the caret
         m_editBox->m_caret.setSize({m_editBox->m_caret.getSize().x,
                                     m_editBox->getSize().y - getScaledPadding().bottom - getScaledPadding().top});
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1379,6 +1442,8 @@ namespace tgui
     void EditBoxRenderer::setCaretWidth(float width)
     {
         m_editBox->setCaretWidth(width);
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1386,13 +1451,9 @@ namespace tgui
     void EditBoxRenderer::setTextColor(const Color& textColor)
     {
         m_textColor = textColor;
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_editBox->m_textBeforeSelection.setFillColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
-        m_editBox->m_textAfterSelection.setFillColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
-#else
-        m_editBox->m_textBeforeSelection.setColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
-        m_editBox->m_textAfterSelection.setColor(calcColorOpacity(m_textColor, m_editBox->getOpacity()));
-#endif
+        m_editBox->updateTextColor();
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1400,11 +1461,9 @@ namespace tgui
     void EditBoxRenderer::setSelectedTextColor(const Color& selectedTextColor)
     {
         m_selectedTextColor = selectedTextColor;
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_editBox->m_textSelection.setFillColor(calcColorOpacity(m_selectedTextColor, m_editBox->getOpacity()));
-#else
-        m_editBox->m_textSelection.setColor(calcColorOpacity(m_selectedTextColor, m_editBox->getOpacity()));
-#endif
+        m_editBox->updateTextColor();
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1413,6 +1472,8 @@ namespace tgui
     {
         m_selectedTextBackgroundColor = selectedTextBackgroundColor;
         m_editBox->m_selectedTextBackground.setFillColor(calcColorOpacity(m_selectedTextBackgroundColor, m_editBox->getOpacity()));
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1425,6 +1486,8 @@ namespace tgui
 #else
         m_editBox->m_defaultText.setColor(calcColorOpacity(m_defaultTextColor, m_editBox->getOpacity()));
 #endif
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1440,6 +1503,8 @@ namespace tgui
     void EditBoxRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1447,6 +1512,8 @@ namespace tgui
     void EditBoxRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1455,6 +1522,8 @@ namespace tgui
     {
         m_caretColor = caretColor;
         m_editBox->m_caret.setFillColor(calcColorOpacity(m_caretColor, m_editBox->getOpacity()));
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1462,6 +1531,8 @@ namespace tgui
     void EditBoxRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1475,6 +1546,8 @@ namespace tgui
             m_textureNormal.setSize(m_editBox->getSize());
             m_textureNormal.setColor({m_textureNormal.getColor().r, m_textureNormal.getColor().g, m_textureNormal.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1488,6 +1561,8 @@ namespace tgui
             m_textureHover.setSize(m_editBox->getSize());
             m_textureHover.setColor({m_textureHover.getColor().r, m_textureHover.getColor().g, m_textureHover.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1501,6 +1576,8 @@ namespace tgui
             m_textureFocused.setSize(m_editBox->getSize());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_editBox->getOpacity() * 255)});
         }
+
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1508,6 +1585,16 @@ namespace tgui
     void EditBoxRenderer::setDefaultTextStyle(sf::Uint32 style)
     {
         m_editBox->m_defaultText.setStyle(style);
+
+        m_editBox->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_editBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,7 +84,7 @@ namespace tgui
 
     Grid::Ptr Grid::create()
     {
-        return std::make_shared<Grid>();
+        return makePooled<Grid>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,7 +52,7 @@ namespace tgui
 
     Knob::Ptr Knob::create()
     {
-        return std::make_shared<Knob>();
+        return makePooled<Knob>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,6 +199,8 @@ namespace tgui
             m_callback.value = m_value;
             sendSignal("ValueChanged", m_value);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -591,6 +593,8 @@ namespace tgui
     void KnobRenderer::setImageRotation(float rotation)
     {
         m_imageRotation = rotation;
+
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -598,6 +602,8 @@ namespace tgui
     void KnobRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +611,8 @@ namespace tgui
     void KnobRenderer::setThumbColor(const Color& color)
     {
         m_thumbColor = color;
+
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +620,8 @@ namespace tgui
     void KnobRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +636,8 @@ namespace tgui
             if (m_foregroundTexture.isLoaded())
                 m_knob->updateSize();
         }
+
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,6 +657,16 @@ namespace tgui
             else
                 m_foregroundTexture.setRotation(360 - m_knob->m_angle + m_imageRotation);
         }
+
+        m_knob->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void KnobRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_knob->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,8 @@
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 
 #include <cmath>
 
@@ -52,7 +54,7 @@ namespace tgui
 
     Label::Ptr Label::create(sf::String text)
     {
-        auto label = std::make_shared<Label>();
+        auto label = makePooled<Label>();
 
         if (!text.isEmpty())
             label->setText(text);
@@ -83,10 +85,11 @@ namespace tgui
             sf::Vector2f pos{std::round(getPosition().x + getRenderer()->getPadding().left),
                              getPosition().y + getRenderer()->getPadding().top - getTextVerticalCorrection(getFont(), m_textSize, m_textStyle)};
 
+            const std::size_t lineCount = m_textLayout ? m_textLayout->getLines().size() : 0;
             if (m_verticalAlignment != VerticalAlignment::Top)
             {
                 float totalHeight = getSize().y - getRenderer()->getPadding().top - getRenderer()->getPadding().bottom;
-                float totalTextHeight = m_lines.size() * getFont()->getLineSpacing(m_textSize);
+                float totalTextHeight = lineCount * getFont()->getLineSpacing(m_textSize);
 
                 if (m_verticalAlignment == VerticalAlignment::Center)
                     pos.y += (totalHeight - totalTextHeight) / 2.f;
@@ -94,11 +97,12 @@ namespace tgui
                     pos.y += totalHeight - totalTextHeight;
             }
 
+            m_linePositions.resize(lineCount);
             if (m_horizontalAlignment == HorizontalAlignment::Left)
             {
-                for (auto& line : m_lines)
+                for (auto& linePos : m_linePositions)
                 {
-                    line.setPosition(pos.x, std::floor(pos.y));
+                    linePos = {pos.x, std::floor(pos.y)};
                     pos.y += getFont()->getLineSpacing(m_textSize);
                 }
             }
@@ -106,24 +110,20 @@ namespace tgui
             {
                 float totalWidth = getSize().x - getRenderer()->getPadding().left - getRenderer()->getPadding().right;
 
-                for (auto& line : m_lines)
+                for (std::size_t i = 0; i < lineCount; ++i)
                 {
-                    line.setPosition(0, 0);
-
-                    std::size_t lastChar = line.getString().getSize();
-                    while (lastChar > 0 && isWhitespace(line.getString()[lastChar-1]))
-                        lastChar--;
-
-                    float textWidth = line.findCharacterPos(lastChar).x;
+                    float textWidth = m_textLayout->getLines()[i].width;
 
                     if (m_horizontalAlignment == HorizontalAlignment::Center)
-                        line.setPosition(std::round(pos.x + (totalWidth - textWidth) / 2.f), std::floor(pos.y));
+                        m_linePositions[i] = {std::round(pos.x + (totalWidth - textWidth) / 2.f), std::floor(pos.y)};
                     else if (m_horizontalAlignment == HorizontalAlignment::Right)
-                        line.setPosition(std::round(pos.x + totalWidth - textWidth), std::floor(pos.y));
+                        m_linePositions[i] = {std::round(pos.x + totalWidth - textWidth), std::floor(pos.y)};
 
                     pos.y += getFont()->getLineSpacing(m_textSize);
                 }
             }
+
+            updateTextVertices();
         }
     }
 
@@ -163,6 +163,8 @@ namespace tgui
     {
         m_string = string;
         rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,13 +282,7 @@ namespace tgui
     {
         Widget::setOpacity(opacity);
 
-        sf::Color textColor = calcColorOpacity(getRenderer()->m_textColor, getOpacity());
-        for (auto& line : m_lines)
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-            line.setFillColor(textColor);
-#else
-            line.setColor(textColor);
-#endif
+        updateTextVertices();
 
         m_background.setFillColor(calcColorOpacity(getRenderer()->m_backgroundColor, getOpacity()));
     }
@@ -329,6 +325,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
     }
@@ -361,8 +358,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
+        TGUI_PROFILE_SCOPE("Text", "Label");
+
         if (!getFont())
             return;
 
@@ -373,114 +379,63 @@ namespace tgui
         else if (getSize().x > getRenderer()->getPadding().left + getRenderer()->getPadding().right)
             maxWidth = getSize().x - getRenderer()->getPadding().left - getRenderer()->getPadding().right;
 
-        m_lines.clear();
-        unsigned int index = 0;
-        unsigned int lineCount = 0;
-        float calculatedLabelWidth = 0;
-        bool bold = (m_textStyle & sf::Text::Bold) != 0;
-        while (index < m_string.getSize())
-        {
-            lineCount++;
-            unsigned int oldIndex = index;
-
-            float width = 0;
-            sf::Uint32 prevChar = 0;
-            for (std::size_t i = index; i < m_string.getSize(); ++i)
-            {
-                float charWidth;
-                sf::Uint32 curChar = m_string[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).textureRect.width) * 4;
-                else
-                    charWidth = static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).textureRect.width);
-
-                float kerning = static_cast<float>(getFont()->getKerning(prevChar, curChar, m_textSize));
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
-                {
-                    if (curChar == '\t')
-                        width += (static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).advance) * 4) + kerning;
-                    else
-                        width += static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).advance) + kerning;
+        m_textLayout = TextLayoutCache::getLayout(m_string, getFont(), m_textSize, m_textStyle, maxWidth);
 
-                    index++;
-                }
-                else
-                    break;
+        // There is always at least one line
+        const std::size_t lineCount = std::max<std::size_t>(1, m_textLayout->getLines().size());
 
-                prevChar = curChar;
-            }
+        if (m_autoSize)
+        {
+            Widget::setSize({std::max(m_textLayout->getWidth(), maxWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
+                             (lineCount * getFont()->getLineSpacing(m_textSize)) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom});
 
-            calculatedLabelWidth = std::max(calculatedLabelWidth, width);
+            m_background.setSize(getSize());
+        }
 
-            // Every line contains at least one character
-            if (index == oldIndex)
-                index++;
+        updatePosition();
+    }
 
-            // Implement the word-wrap
-            if (m_string[index-1] != '\n')
-            {
-                unsigned int indexWithoutWordWrap = index;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if ((index < m_string.getSize()) && (!isWhitespace(m_string[index])))
-                {
-                    unsigned int wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(m_string[index - 1])))
-                    {
-                        wordWrapCorrection++;
-                        index--;
-                    }
-
-                    // The word can't be split but there is no other choice, it does not fit on the line
-                    if ((index - oldIndex) <= wordWrapCorrection)
-                        index = indexWithoutWordWrap;
-                }
-            }
+    void Label::updateTextVertices()
+    {
+        if (!m_textLayout)
+            return;
 
-            // Add the next line
-            m_lines.emplace_back();
-            m_lines.back().setFont(*getFont());
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setStyle(getTextStyle());
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-            m_lines.back().setFillColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-#else
-            m_lines.back().setColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
-#endif
-
-            if ((index < m_string.getSize()) && (m_string[index-1] != '\n'))
-                m_lines.back().setString(m_string.substring(oldIndex, index - oldIndex) + "\n");
-            else
-                m_lines.back().setString(m_string.substring(oldIndex, index - oldIndex));
+        const sf::Color textColor = calcColorOpacity(getRenderer()->m_textColor, getOpacity());
 
-            // If the next line starts with just a space, then the space need not be visible
-            if ((index < m_string.getSize()) && (m_string[index] == ' '))
+        // The lines are moved to their position inside the copied vertices, so that all text can be drawn at once
+        m_textVertices = m_textLayout->getVertices();
+        const auto& lines = m_textLayout->getLines();
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            const sf::Vector2f linePosition = (i < m_linePositions.size()) ? m_linePositions[i] : sf::Vector2f{};
+            for (std::size_t j = lines[i].firstVertex; j < lines[i].firstVertex + lines[i].vertexCount; ++j)
             {
-                if ((index == 0) || (!isWhitespace(m_string[index-1])))
-                {
-                    // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                    if (((index + 1 < m_string.getSize()) && (!isWhitespace(m_string[index + 1]))) || (index + 1 == m_string.getSize()))
-                        index++;
-                }
+                m_textVertices[j].position += linePosition;
+                m_textVertices[j].color = textColor;
             }
         }
+    }
 
-        // There is always at least one line
-        lineCount = std::max(1u, lineCount);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_autoSize)
-        {
-            Widget::setSize({std::max(calculatedLabelWidth, maxWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
-                             (lineCount * getFont()->getLineSpacing(m_textSize)) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom});
+    void Label::drawText(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        if (m_textVertices.empty() || !getFont())
+            return;
 
-            m_background.setSize(getSize());
+        const auto& distanceFieldFont = m_textLayout->getDistanceFieldFont();
+        if (distanceFieldFont)
+        {
+            states.texture = &distanceFieldFont->getTexture();
+            states.shader = DistanceFieldFont::getShader();
         }
+        else
+            states.texture = &getFont()->getTexture(m_textSize);
 
-        updatePosition();
+        target.draw(m_textVertices.data(), m_textVertices.size(), sf::Triangles, states);
+        TGUI_PROFILE_DRAW_CALL(m_textVertices.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -494,8 +449,7 @@ namespace tgui
                 target.draw(m_background, states);
 
             // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
+            drawText(target, states);
         }
         else
         {
@@ -508,8 +462,7 @@ namespace tgui
             Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
 
             // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
+            drawText(target, states);
         }
 
         getRenderer()->draw(target, states);
@@ -607,6 +560,8 @@ namespace tgui
             WidgetPadding::setPadding(padding);
             m_label->rearrangeText();
         }
+
+        m_label->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,13 +570,9 @@ namespace tgui
     {
         m_textColor = color;
 
-        sf::Color textColor = calcColorOpacity(m_textColor, m_label->getOpacity());
-		for (auto& line : m_label->m_lines)
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-            line.setFillColor(textColor);
-#else
-            line.setColor(textColor);
-#endif
+        m_label->updateTextVertices();
+
+        m_label->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,6 +581,8 @@ namespace tgui
     {
         m_backgroundColor = color;
         m_label->m_background.setFillColor(calcColorOpacity(m_backgroundColor, m_label->getOpacity()));
+
+        m_label->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -637,6 +590,16 @@ namespace tgui
     void LabelRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_label->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LabelRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_label->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,7 +97,7 @@ namespace tgui
 
     ListBox::Ptr ListBox::create()
     {
-        return std::make_shared<ListBox>();
+        return makePooled<ListBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +221,7 @@ namespace tgui
             m_itemIds.push_back(id);
 
             updatePosition();
+            invalidate();
             return true;
         }
         else // The item limit was reached
@@ -285,6 +286,7 @@ namespace tgui
             updatePosition();
         }
 
+        invalidate();
         return true;
     }
 
@@ -297,6 +299,8 @@ namespace tgui
             m_items[m_selectedItem].setTextColor(getRenderer()->m_textColor);
             m_selectedItem = -1;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +363,7 @@ namespace tgui
         if (m_hoveringItem >= 0)
             m_items[m_hoveringItem].setTextColor(getRenderer()->m_hoverTextColor);
 
+        invalidate();
         return true;
     }
 
@@ -377,6 +382,8 @@ namespace tgui
         // If there is a scrollbar then tell it that all item were removed
         if (m_scroll != nullptr)
             m_scroll->setMaximum(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,6 +454,7 @@ namespace tgui
             return false;
 
         m_items[index].setText(newValue);
+        invalidate();
         return true;
     }
 
@@ -744,6 +752,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
     }
@@ -983,6 +992,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // Draw the background
@@ -1209,6 +1225,8 @@ namespace tgui
     void ListBoxRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1225,6 +1243,8 @@ namespace tgui
     {
         m_textColor = color;
         m_listBox->updateItemColors();
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1233,6 +1253,8 @@ namespace tgui
     {
         m_hoverTextColor = color;
         m_listBox->updateItemColors();
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1240,6 +1262,8 @@ namespace tgui
     void ListBoxRenderer::setHoverBackgroundColor(const Color& hoverBackgroundColor)
     {
         m_hoverBackgroundColor = hoverBackgroundColor;
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1247,6 +1271,8 @@ namespace tgui
     void ListBoxRenderer::setSelectedBackgroundColor(const Color& selectedBackgroundColor)
     {
         m_selectedBackgroundColor = selectedBackgroundColor;
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1255,6 +1281,8 @@ namespace tgui
     {
         m_selectedTextColor = selectedTextColor;
         m_listBox->updateItemColors();
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1262,6 +1290,8 @@ namespace tgui
     void ListBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1275,6 +1305,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_listBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_listBox->getOpacity() * 255)});
         }
+
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1284,6 +1316,16 @@ namespace tgui
         WidgetPadding::setPadding(padding);
 
         m_listBox->updateSize();
+
+        m_listBox->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_listBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@ namespace tgui
 
     MenuBar::Ptr MenuBar::create()
     {
-        return std::make_shared<MenuBar>();
+        return makePooled<MenuBar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +234,9 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        m_visibleMenu = -1;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +280,8 @@ namespace tgui
 
             m_menus[m_visibleMenu].text.setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
             m_visibleMenu = -1;
+
+            invalidate();
         }
     }
 
@@ -308,6 +313,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::invalidate()
+    {
+        Widget::invalidate();
+
+        // The menus are drawn below the menu bar, outside the area that Widget::invalidate reported
+        const sf::FloatRect menuArea = getOpenMenuArea();
+        if ((m_invalidatedMenuArea != sf::FloatRect{}) && (m_invalidatedMenuArea != menuArea))
+            invalidateArea(m_invalidatedMenuArea);
+
+        if (menuArea != sf::FloatRect{})
+            invalidateArea(menuArea);
+
+        m_invalidatedMenuArea = menuArea;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::setParent(Container* parent)
     {
         Widget::setParent(parent);
@@ -323,31 +345,9 @@ namespace tgui
         // Check if the mouse is on top of the menu bar
         if (sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(x, y))
             return true;
-        else
-        {
-            // Check if there is a menu open
-            if (m_visibleMenu != -1)
-            {
-                // Search the left position of the open menu
-                float left = 0;
-                for (int i = 0; i < m_visibleMenu; ++i)
-                    left += m_menus[i].text.getSize().x + (2 * getRenderer()->m_distanceToSide);
-
-                // Find out what the width of the menu should be
-                float width = m_minimumSubMenuWidth;
-                for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
-                {
-                    if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * getRenderer()->m_distanceToSide))
-                        width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * getRenderer()->m_distanceToSide);
-                }
-
-                // Check if the mouse is on top of the open menu
-                if (sf::FloatRect{getPosition().x + left, getPosition().y + getSize().y, width, getSize().y * m_menus[m_visibleMenu].menuItems.size()}.contains(x, y))
-                    return true;
-            }
-        }
 
-        return false;
+        // Check if the mouse is on top of the open menu
+        return getOpenMenuArea().contains(x, y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,6 +510,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect MenuBar::getOpenMenuArea() const
+    {
+        if (m_visibleMenu == -1)
+            return {};
+
+        // Search the left position of the open menu
+        float left = 0;
+        for (int i = 0; i < m_visibleMenu; ++i)
+            left += m_menus[i].text.getSize().x + (2 * getRenderer()->m_distanceToSide);
+
+        // Find out what the width of the menu should be
+        float width = m_minimumSubMenuWidth;
+        for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
+        {
+            if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * getRenderer()->m_distanceToSide))
+                width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * getRenderer()->m_distanceToSide);
+        }
+
+        return {getPosition().x + left, getPosition().y + getSize().y, width, getSize().y * m_menus[m_visibleMenu].menuItems.size()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBackgroundColor({255, 255, 255});
@@ -666,6 +689,8 @@ namespace tgui
     void MenuBarRenderer::setBackgroundColor(const Color& backgroundColor)
     {
         m_backgroundColor = backgroundColor;
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -684,6 +709,8 @@ namespace tgui
 
             m_menuBar->m_menus[i].text.setTextColor(calcColorOpacity(m_textColor, m_menuBar->getOpacity()));
         }
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -691,6 +718,8 @@ namespace tgui
     void MenuBarRenderer::setSelectedBackgroundColor(const Color& selectedBackgroundColor)
     {
         m_selectedBackgroundColor = selectedBackgroundColor;
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -704,6 +733,8 @@ namespace tgui
             if (m_menuBar->m_menus[m_menuBar->m_visibleMenu].selectedMenuItem != -1)
                 m_menuBar->m_menus[m_menuBar->m_visibleMenu].menuItems[m_menuBar->m_menus[m_menuBar->m_visibleMenu].selectedMenuItem].setTextColor(calcColorOpacity(m_selectedTextColor, m_menuBar->getOpacity()));
         }
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -711,6 +742,8 @@ namespace tgui
     void MenuBarRenderer::setDistanceToSide(float distanceToSide)
     {
         m_distanceToSide = distanceToSide;
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -724,6 +757,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_menuBar->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -737,6 +772,8 @@ namespace tgui
             m_itemBackgroundTexture.setSize(m_menuBar->getSize());
             m_itemBackgroundTexture.setColor({m_itemBackgroundTexture.getColor().r, m_itemBackgroundTexture.getColor().g, m_itemBackgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -750,6 +787,8 @@ namespace tgui
             m_selectedItemBackgroundTexture.setSize(m_menuBar->getSize());
             m_selectedItemBackgroundTexture.setColor({m_selectedItemBackgroundTexture.getColor().r, m_selectedItemBackgroundTexture.getColor().g, m_selectedItemBackgroundTexture.getColor().b, static_cast<sf::Uint8>(m_menuBar->getOpacity() * 255)});
         }
+
+        m_menuBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
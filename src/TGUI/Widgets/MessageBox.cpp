@@ -91,7 +91,7 @@ namespace tgui
 
     MessageBox::Ptr MessageBox::create()
     {
-        return std::make_shared<MessageBox>();
+        return makePooled<MessageBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,7 +146,7 @@ namespace tgui
     {
         Button::Ptr button;
         if (!getTheme() || m_buttonClassName.empty())
-            button = std::make_shared<Button>();
+            button = makePooled<Button>();
         else
             button = getTheme()->internalLoad(getPrimaryLoadingParameter(), m_buttonClassName);
 
@@ -312,6 +312,8 @@ namespace tgui
     void MessageBoxRenderer::setTextColor(const Color& color)
     {
         m_messageBox->m_label->setTextColor(color);
+
+        m_messageBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,7 +57,7 @@ namespace tgui
 
     Panel::Ptr Panel::create(Layout2d size)
     {
-        return std::make_shared<Panel>(size);
+        return makePooled<Panel>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -237,6 +237,8 @@ namespace tgui
     void PanelRenderer::setBackgroundColor(const Color& color)
     {
         m_panel->setBackgroundColor(color);
+
+        m_panel->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,6 +246,16 @@ namespace tgui
     void PanelRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_panel->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PanelRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_panel->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -65,7 +65,7 @@ namespace tgui
 
     Picture::Ptr Picture::create(const Texture& texture, bool fullyClickable)
     {
-        return std::make_shared<Picture>(texture, fullyClickable);
+        return makePooled<Picture>(texture, fullyClickable);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +90,8 @@ namespace tgui
         m_texture.setSize(getSize());
         m_texture.setPosition(getPosition());
         m_texture.setColor({m_texture.getColor().r, m_texture.getColor().g, m_texture.getColor().b, static_cast<sf::Uint8>(m_opacity * 255)});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +178,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
     }
@@ -196,6 +199,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         target.draw(m_texture, states);
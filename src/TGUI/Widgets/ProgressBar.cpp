@@ -51,7 +51,7 @@ namespace tgui
 
     ProgressBar::Ptr ProgressBar::create()
     {
-        return std::make_shared<ProgressBar>();
+        return makePooled<ProgressBar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,6 +205,8 @@ namespace tgui
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateSize();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +254,8 @@ namespace tgui
 
         // Reposition the text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -515,6 +519,8 @@ namespace tgui
     {
         m_textColorBack = color;
         m_progressBar->m_textBack.setTextColor(calcColorOpacity(m_textColorBack, m_progressBar->getOpacity()));
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,6 +529,8 @@ namespace tgui
     {
         m_textColorFront = color;
         m_progressBar->m_textFront.setTextColor(calcColorOpacity(m_textColorFront, m_progressBar->getOpacity()));
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,6 +538,8 @@ namespace tgui
     void ProgressBarRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -537,6 +547,8 @@ namespace tgui
     void ProgressBarRenderer::setForegroundColor(const Color& color)
     {
         m_foregroundColor = color;
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,6 +556,8 @@ namespace tgui
     void ProgressBarRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +574,8 @@ namespace tgui
             if (m_textureFront.isLoaded())
                 m_progressBar->updateSize();
         }
+
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +590,16 @@ namespace tgui
 
             m_textureFront.setColor({m_textureFront.getColor().r, m_textureFront.getColor().g, m_textureFront.getColor().b, static_cast<sf::Uint8>(m_progressBar->getOpacity() * 255)});
         }
+
+        m_progressBar->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ProgressBarRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_progressBar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +55,7 @@ namespace tgui
 
     RadioButton::Ptr RadioButton::create()
     {
-        return std::make_shared<RadioButton>();
+        return makePooled<RadioButton>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +149,8 @@ namespace tgui
             m_callback.checked = true;
             sendSignal("Checked", static_cast<int>(m_checked));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +164,8 @@ namespace tgui
             m_callback.checked = false;
             sendSignal("Unchecked", static_cast<int>(m_checked));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +183,8 @@ namespace tgui
 
         // Reposition the text
         updatePosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -537,6 +543,8 @@ namespace tgui
 
         if (!m_radioButton->m_mouseHover)
             m_radioButton->m_text.setTextColor(calcColorOpacity(m_textColorNormal, m_radioButton->getOpacity()));
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -547,6 +555,8 @@ namespace tgui
 
         if (m_radioButton->m_mouseHover)
             m_radioButton->m_text.setTextColor(calcColorOpacity(m_textColorHover, m_radioButton->getOpacity()));
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,6 +572,8 @@ namespace tgui
     void RadioButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -569,6 +581,8 @@ namespace tgui
     void RadioButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,6 +598,8 @@ namespace tgui
     void RadioButtonRenderer::setForegroundColorNormal(const Color& color)
     {
         m_foregroundColorNormal = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -591,6 +607,8 @@ namespace tgui
     void RadioButtonRenderer::setForegroundColorHover(const Color& color)
     {
         m_foregroundColorHover = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -606,6 +624,8 @@ namespace tgui
     void RadioButtonRenderer::setCheckColorNormal(const Color& color)
     {
         m_checkColorNormal = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -613,6 +633,8 @@ namespace tgui
     void RadioButtonRenderer::setCheckColorHover(const Color& color)
     {
         m_checkColorHover = color;
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,6 +649,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -641,6 +665,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,6 +681,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -669,6 +697,8 @@ namespace tgui
             if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
                 m_radioButton->updateSize();
         }
+
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -682,6 +712,16 @@ namespace tgui
             m_textureFocused.setPosition(m_radioButton->getPosition());
             m_textureFocused.setColor({m_textureFocused.getColor().r, m_textureFocused.getColor().g, m_textureFocused.getColor().b, static_cast<sf::Uint8>(m_radioButton->getOpacity() * 255)});
         }
+
+        m_radioButton->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonRenderer::setPadding(const Padding& padding)
+    {
+        WidgetPadding::setPadding(padding);
+        m_radioButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
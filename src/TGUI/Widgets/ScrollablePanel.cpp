@@ -0,0 +1,395 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollablePanel::ScrollablePanel(const Layout2d& size) :
+        Panel{size}
+    {
+        m_callback.widgetType = "ScrollablePanel";
+
+        m_scroll->setArrowScrollAmount(20);
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollablePanel::ScrollablePanel(const ScrollablePanel& panelToCopy) :
+        Panel               {panelToCopy},
+        m_scroll            {Scrollbar::copy(panelToCopy.m_scroll)},
+        m_contentHeight     {panelToCopy.m_contentHeight},
+        m_totalContentHeight{panelToCopy.m_totalContentHeight},
+        m_scrollOffset      {panelToCopy.m_scrollOffset}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollablePanel& ScrollablePanel::operator= (const ScrollablePanel& right)
+    {
+        if (this != &right)
+        {
+            ScrollablePanel temp{right};
+            Panel::operator=(right);
+
+            std::swap(m_scroll,             temp.m_scroll);
+            std::swap(m_contentHeight,      temp.m_contentHeight);
+            std::swap(m_totalContentHeight, temp.m_totalContentHeight);
+            std::swap(m_scrollOffset,       temp.m_scrollOffset);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollablePanel::Ptr ScrollablePanel::create(Layout2d size)
+    {
+        return makePooled<ScrollablePanel>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollablePanel::Ptr ScrollablePanel::copy(ScrollablePanel::ConstPtr panel)
+    {
+        if (panel)
+            return std::static_pointer_cast<ScrollablePanel>(panel->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setPosition(const Layout2d& position)
+    {
+        Panel::setPosition(position);
+
+        if (m_scroll != nullptr)
+            m_scroll->setPosition(getPosition().x + getSize().x - m_scroll->getSize().x, getPosition().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setSize(const Layout2d& size)
+    {
+        Panel::setSize(size);
+
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::add(const Widget::Ptr& widgetPtr, const sf::String& widgetName)
+    {
+        Panel::add(widgetPtr, widgetName);
+
+        updateContentHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::remove(const Widget::Ptr& widget)
+    {
+        const bool removed = Panel::remove(widget);
+
+        updateContentHeight();
+        return removed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::removeAllWidgets()
+    {
+        Panel::removeAllWidgets();
+
+        updateContentHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setContentHeight(float height)
+    {
+        m_contentHeight = std::max(0.f, height);
+
+        updateContentHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ScrollablePanel::getContentHeight() const
+    {
+        return m_contentHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setScrollbar(Scrollbar::Ptr scrollbar)
+    {
+        m_scroll = scrollbar;
+
+        if (m_scroll != nullptr)
+            m_scroll->setOpacity(m_opacity);
+
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Scrollbar::Ptr ScrollablePanel::getScrollbar() const
+    {
+        return m_scroll;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setScrollOffset(float offset)
+    {
+        offset = std::max(0.f, std::min(offset, m_totalContentHeight - getSize().y));
+        if (m_scroll != nullptr)
+            m_scroll->setValue(static_cast<unsigned int>(offset));
+
+        if (m_scrollOffset != offset)
+        {
+            m_scrollOffset = offset;
+            invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setOpacity(float opacity)
+    {
+        Panel::setOpacity(opacity);
+
+        if (m_scroll != nullptr)
+            m_scroll->setOpacity(m_opacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::leftMousePressed(float x, float y)
+    {
+        // The scrollbar lies on top of the child widgets
+        if (isScrollbarShown() && m_scroll->mouseOnWidget(x, y))
+        {
+            m_mouseDown = true;
+            m_scroll->leftMousePressed(x, y);
+            updateScrollOffsetFromScrollbar();
+            return;
+        }
+
+        Panel::leftMousePressed(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::leftMouseReleased(float x, float y)
+    {
+        // Only the scrollbar receives the event when the mouse went down on it
+        if ((m_scroll != nullptr) && m_scroll->m_mouseDown)
+        {
+            m_scroll->leftMouseReleased(x, y);
+            updateScrollOffsetFromScrollbar();
+            m_mouseDown = false;
+            return;
+        }
+
+        Panel::leftMouseReleased(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::mouseMoved(float x, float y)
+    {
+        if (m_scroll != nullptr)
+        {
+            // Check if you are dragging the thumb of the scrollbar
+            if (m_scroll->m_mouseDown && m_scroll->m_mouseDownOnThumb)
+            {
+                m_scroll->mouseMoved(x, y);
+                updateScrollOffsetFromScrollbar();
+                return;
+            }
+
+            if (isScrollbarShown() && m_scroll->mouseOnWidget(x, y))
+            {
+                Widget::mouseMoved(x, y);
+                m_scroll->mouseMoved(x, y);
+
+                // The mouse left the child widget when it moved on top of the scrollbar
+                if (m_widgetBelowMouse)
+                {
+                    m_widgetBelowMouse->mouseNoLongerOnWidget();
+                    m_widgetBelowMouse = nullptr;
+                }
+
+                invalidate();
+                return;
+            }
+            else if (m_scroll->m_mouseHover)
+            {
+                m_scroll->mouseNoLongerOnWidget();
+                invalidate();
+            }
+        }
+
+        Panel::mouseMoved(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::mouseWheelMoved(int delta, int x, int y)
+    {
+        // The child widgets only receive the mouse wheel events when there is nothing to scroll
+        if (m_totalContentHeight <= getSize().y)
+        {
+            Panel::mouseWheelMoved(delta, x, y);
+            return;
+        }
+
+        const float scrollAmount = (m_scroll != nullptr) ? static_cast<float>(m_scroll->getArrowScrollAmount()) : 20.f;
+        setScrollOffset(m_scrollOffset - delta * scrollAmount);
+
+        // The widget below the mouse may have changed
+        mouseMoved(static_cast<float>(x), static_cast<float>(y));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::mouseNoLongerOnWidget()
+    {
+        Panel::mouseNoLongerOnWidget();
+
+        if (m_scroll != nullptr)
+            m_scroll->m_mouseHover = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::mouseNoLongerDown()
+    {
+        Panel::mouseNoLongerDown();
+
+        if (m_scroll != nullptr)
+            m_scroll->mouseNoLongerDown();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::isChildWidgetInView(const Widget& widget) const
+    {
+        const sf::Vector2f position = widget.getPosition() - widget.getWidgetOffset();
+        const sf::Vector2f size = widget.getFullSize();
+
+        return (position.x + size.x > 0) && (position.x < getSize().x)
+            && (position.y + size.y > m_scrollOffset) && (position.y < m_scrollOffset + getSize().y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::childInvalidated(const sf::FloatRect& area)
+    {
+        Panel::childInvalidated(area);
+
+        // Only the bottom of the changed widget has to be checked, shrinking the contents would require looping over all widgets
+        if ((m_contentHeight == 0) && (area.top + area.height > m_totalContentHeight))
+        {
+            m_totalContentHeight = area.top + area.height;
+            updateScrollbar();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateContentHeight()
+    {
+        if (m_contentHeight > 0)
+            m_totalContentHeight = m_contentHeight;
+        else
+        {
+            m_totalContentHeight = 0;
+            for (const auto& widget : m_widgets)
+                m_totalContentHeight = std::max(m_totalContentHeight, widget->getPosition().y - widget->getWidgetOffset().y + widget->getFullSize().y);
+        }
+
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateScrollbar()
+    {
+        if (m_scroll != nullptr)
+        {
+            m_scroll->setSize({m_scroll->getSize().x, getSize().y});
+            m_scroll->setLowValue(static_cast<unsigned int>(getSize().y));
+            m_scroll->setMaximum(static_cast<unsigned int>(std::ceil(m_totalContentHeight)));
+            m_scroll->setPosition(getPosition().x + getSize().x - m_scroll->getSize().x, getPosition().y);
+        }
+
+        // The contents may no longer reach the bottom of the panel at the current offset
+        setScrollOffset(m_scrollOffset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateScrollOffsetFromScrollbar()
+    {
+        m_scrollOffset = isScrollbarShown() ? static_cast<float>(m_scroll->getValue()) : 0.f;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::isScrollbarShown() const
+    {
+        return (m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        Panel::draw(target, states);
+
+        // The scrollbar is positioned relative to the parent, so it is drawn with the untranslated states
+        if (m_scroll != nullptr)
+            target.draw(*m_scroll, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@ namespace tgui
 
     Scrollbar::Ptr Scrollbar::create()
     {
-        return std::make_shared<Scrollbar>();
+        return makePooled<Scrollbar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +271,8 @@ namespace tgui
             // Recalculate the size and position of the thumb image
             updateSize();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -939,6 +941,8 @@ namespace tgui
     void ScrollbarRenderer::setTrackColorNormal(const Color& color)
     {
         m_trackColorNormal = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -946,6 +950,8 @@ namespace tgui
     void ScrollbarRenderer::setTrackColorHover(const Color& color)
     {
         m_trackColorHover = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -961,6 +967,8 @@ namespace tgui
     void ScrollbarRenderer::setThumbColorNormal(const Color& color)
     {
         m_thumbColorNormal = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -968,6 +976,8 @@ namespace tgui
     void ScrollbarRenderer::setThumbColorHover(const Color& color)
     {
         m_thumbColorHover = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -983,6 +993,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowBackgroundColorNormal(const Color& color)
     {
         m_arrowBackgroundColorNormal = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -990,6 +1002,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowBackgroundColorHover(const Color& color)
     {
         m_arrowBackgroundColorHover = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1005,6 +1019,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1012,6 +1028,8 @@ namespace tgui
     void ScrollbarRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1026,6 +1044,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1040,6 +1060,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1054,6 +1076,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1068,6 +1092,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1082,6 +1108,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1096,6 +1124,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1110,6 +1140,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1124,6 +1156,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_scrollbar->updateSize();
         }
+
+        m_scrollbar->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@ namespace tgui
 
     Slider::Ptr Slider::create(int minimum, int maximum)
     {
-        auto slider = std::make_shared<Slider>();
+        auto slider = makePooled<Slider>();
 
         slider->setMinimum(minimum);
         slider->setMaximum(maximum);
@@ -246,6 +246,8 @@ namespace tgui
             // Recalculate the position of the thumb image
             updatePosition();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -610,6 +612,8 @@ namespace tgui
     void SliderRenderer::setTrackColorNormal(const Color& color)
     {
         m_trackColorNormal = color;
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -617,6 +621,8 @@ namespace tgui
     void SliderRenderer::setTrackColorHover(const Color& color)
     {
         m_trackColorHover = color;
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,6 +638,8 @@ namespace tgui
     void SliderRenderer::setThumbColorNormal(const Color& color)
     {
         m_thumbColorNormal = color;
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,6 +647,8 @@ namespace tgui
     void SliderRenderer::setThumbColorHover(const Color& color)
     {
         m_thumbColorHover = color;
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -646,6 +656,8 @@ namespace tgui
     void SliderRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -665,6 +677,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -679,6 +693,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -693,6 +709,8 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -707,6 +725,16 @@ namespace tgui
             if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
                 m_slider->updateSize();
         }
+
+        m_slider->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SliderRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_slider->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@ namespace tgui
 
     SpinButton::Ptr SpinButton::create(int minimum, int maximum)
     {
-        auto spinButton = std::make_shared<SpinButton>();
+        auto spinButton = makePooled<SpinButton>();
 
         spinButton->setMinimum(minimum);
         spinButton->setMaximum(maximum);
@@ -164,6 +164,8 @@ namespace tgui
             m_callback.value = m_value;
             sendSignal("ValueChanged", value);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,6 +519,8 @@ namespace tgui
     void SpinButtonRenderer::setBackgroundColorNormal(const Color& color)
     {
         m_backgroundColorNormal = color;
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +528,8 @@ namespace tgui
     void SpinButtonRenderer::setBackgroundColorHover(const Color& color)
     {
         m_backgroundColorHover = color;
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,6 +545,8 @@ namespace tgui
     void SpinButtonRenderer::setArrowColorNormal(const Color& color)
     {
         m_arrowColorNormal = color;
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -546,6 +554,8 @@ namespace tgui
     void SpinButtonRenderer::setArrowColorHover(const Color& color)
     {
         m_arrowColorHover = color;
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -553,6 +563,8 @@ namespace tgui
     void SpinButtonRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -567,6 +579,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,6 +595,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -595,6 +611,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +627,8 @@ namespace tgui
             if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
                 m_spinButton->updateSize();
         }
+
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -618,6 +638,16 @@ namespace tgui
         m_spaceBetweenArrows = space;
 
         m_spinButton->updateSize();
+
+        m_spinButton->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpinButtonRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_spinButton->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
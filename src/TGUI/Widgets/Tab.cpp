@@ -52,7 +52,7 @@ namespace tgui
 
     Tab::Ptr Tab::create()
     {
-        return std::make_shared<Tab>();
+        return makePooled<Tab>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +180,8 @@ namespace tgui
         // If the tab has to be selected then do so
         if (selectTab)
             select(index);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,6 +223,7 @@ namespace tgui
 
         // Recalculate the positions of the tabs
         updatePosition();
+        invalidate();
         return true;
     }
 
@@ -260,6 +263,8 @@ namespace tgui
         // Send the callback
         m_callback.text = m_tabTexts[index].getText();
         sendSignal("TabSelected", m_tabTexts[index].getText());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +275,7 @@ namespace tgui
             m_tabTexts[m_selectedTab].setTextColor(calcColorOpacity(getRenderer()->m_textColor, getOpacity()));
 
         m_selectedTab = -1;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,6 +326,7 @@ namespace tgui
 
         // Recalculate the positions of the tabs
         updatePosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,6 +341,7 @@ namespace tgui
         getRenderer()->m_texturesSelected.clear();
 
         m_width = 0;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -684,6 +692,8 @@ namespace tgui
 
         if (m_tab->m_selectedTab >= 0)
             m_tab->m_tabTexts[m_tab->m_selectedTab].setTextColor(calcColorOpacity(m_selectedTextColor, m_tab->getOpacity()));
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -694,6 +704,8 @@ namespace tgui
 
         if (m_tab->m_selectedTab >= 0)
             m_tab->m_tabTexts[m_tab->m_selectedTab].setTextColor(calcColorOpacity(m_selectedTextColor, m_tab->getOpacity()));
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -703,6 +715,8 @@ namespace tgui
         m_distanceToSide = distanceToSide;
 
         m_tab->recalculateTabsWidth();
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -710,6 +724,8 @@ namespace tgui
     void TabRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -717,6 +733,8 @@ namespace tgui
     void TabRenderer::setSelectedBackgroundColor(const Color& color)
     {
         m_selectedBackgroundColor = color;
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -724,6 +742,8 @@ namespace tgui
     void TabRenderer::setBorderColor(const Color& color)
     {
         m_borderColor = color;
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -749,6 +769,8 @@ namespace tgui
                 m_tab->recalculateTabsWidth();
             }
         }
+
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -774,6 +796,16 @@ namespace tgui
                 m_tab->recalculateTabsWidth();
             }
         }
+
+        m_tab->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TabRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_tab->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
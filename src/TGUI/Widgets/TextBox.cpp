@@ -29,6 +29,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -60,6 +61,7 @@ namespace tgui
         m_textSize           {scrollbarToCopy.m_textSize},
         m_lineHeight         {scrollbarToCopy.m_lineHeight},
         m_lines              (scrollbarToCopy.m_lines), // Did not compile in VS2013 when using braces
+        m_lineOffsets        (scrollbarToCopy.m_lineOffsets), // Did not compile in VS2013 when using braces
         m_maxChars           {scrollbarToCopy.m_maxChars},
         m_topLine            {scrollbarToCopy.m_topLine},
         m_visibleLines       {scrollbarToCopy.m_visibleLines},
@@ -92,6 +94,7 @@ namespace tgui
             std::swap(m_textSize,            temp.m_textSize);
             std::swap(m_lineHeight,          temp.m_lineHeight);
             std::swap(m_lines,               temp.m_lines);
+            std::swap(m_lineOffsets,         temp.m_lineOffsets);
             std::swap(m_maxChars,            temp.m_maxChars);
             std::swap(m_topLine,             temp.m_topLine);
             std::swap(m_visibleLines,        temp.m_visibleLines);
@@ -117,7 +120,7 @@ namespace tgui
 
     TextBox::Ptr TextBox::create()
     {
-        return std::make_shared<TextBox>();
+        return makePooled<TextBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +343,8 @@ namespace tgui
         m_text = text;
 
         rearrangeText(false);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -347,6 +352,8 @@ namespace tgui
     void TextBox::addText(const sf::String& text)
     {
         setText(m_text + text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1269,6 +1276,9 @@ namespace tgui
     #endif
 
         Widget::widgetFocused();
+
+        // The caret has to blink while the widget is focused
+        scheduleUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1323,36 +1333,22 @@ namespace tgui
         if (lineNumber + 1 > m_lines.size())
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
-        // Find between which character the mouse is standing
-        float width = 0;
-        sf::Uint32 prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
-        {
-            float charWidth;
-            sf::Uint32 curChar = m_lines[lineNumber][i];
-            if (curChar == '\n')
-                return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber);
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_font->getGlyph(' ', getTextSize(), false).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_font->getGlyph(curChar, getTextSize(), false).advance);
+        // The character positions of a line are only calculated when they are needed for the first time after the text changed
+        if (m_lineOffsets.size() != m_lines.size())
+            m_lineOffsets.resize(m_lines.size());
 
-            float kerning = static_cast<float>(m_font->getKerning(prevChar, curChar, getTextSize()));
-            if (width + charWidth + kerning <= position.x)
-                width += charWidth + kerning;
-            else
-            {
-                if (position.x < width + kerning + (charWidth / 2.0f))
-                    return {i, lineNumber};
-                else
-                    return {i + 1, lineNumber};
-            }
+        GlyphOffsets& offsets = m_lineOffsets[lineNumber];
+        if (offsets.getCharacterCount() != m_lines[lineNumber].getSize())
+            offsets.setText(m_lines[lineNumber], *m_font, getTextSize());
 
-            prevChar = curChar;
-        }
+        // Find between which character the mouse is standing
+        std::size_t index = offsets.findCaretPosition(position.x);
 
-        // You clicked behind the last character
-        return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize(), lineNumber);
+        // The caret can't be placed behind the newline at the end of the line
+        if ((index > 0) && (index == m_lines[lineNumber].getSize()) && (m_lines[lineNumber][index - 1] == '\n'))
+            --index;
+
+        return {index, lineNumber};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1420,6 +1416,11 @@ namespace tgui
 
     void TextBox::rearrangeText(bool keepSelection)
     {
+        TGUI_PROFILE_SCOPE("Text", "TextBox");
+
+        // The character positions have to be calculated again for the new lines
+        m_lineOffsets.clear();
+
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_font == nullptr))
             return;
@@ -1701,6 +1702,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -1708,6 +1713,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || m_focused || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setBorders(2, 2, 2, 2);
@@ -1932,6 +1944,8 @@ namespace tgui
     void TextBoxRenderer::setBackgroundColor(const Color& color)
     {
         m_backgroundColor = color;
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1942,6 +1956,8 @@ namespace tgui
         m_textBox->m_textBeforeSelection.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
         m_textBox->m_textAfterSelection1.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
         m_textBox->m_textAfterSelection2.setColor(calcColorOpacity(m_textColor, m_textBox->getOpacity()));
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1951,6 +1967,8 @@ namespace tgui
         m_selectedTextColor = color;
         m_textBox->m_textSelection1.setColor(calcColorOpacity(m_selectedTextColor, m_textBox->getOpacity()));
         m_textBox->m_textSelection2.setColor(calcColorOpacity(m_selectedTextColor, m_textBox->getOpacity()));
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1958,6 +1976,8 @@ namespace tgui
     void TextBoxRenderer::setSelectedTextBackgroundColor(const Color& color)
     {
         m_selectedTextBgrColor = color;
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1965,6 +1985,8 @@ namespace tgui
     void TextBoxRenderer::setBorderColor(const Color& borderColor)
     {
         m_borderColor = borderColor;
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1972,6 +1994,8 @@ namespace tgui
     void TextBoxRenderer::setCaretColor(const Color& caretColor)
     {
         m_caretColor = caretColor;
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1979,6 +2003,8 @@ namespace tgui
     void TextBoxRenderer::setCaretWidth(float width = 2)
     {
         m_caretWidth = width;
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1992,6 +2018,8 @@ namespace tgui
             m_backgroundTexture.setSize(m_textBox->getSize());
             m_backgroundTexture.setColor({m_backgroundTexture.getColor().r, m_backgroundTexture.getColor().g, m_backgroundTexture.getColor().b, static_cast<sf::Uint8>(m_textBox->getOpacity() * 255)});
         }
+
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2000,6 +2028,16 @@ namespace tgui
     {
         WidgetPadding::setPadding(padding);
         m_textBox->updateSize();
+
+        m_textBox->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBoxRenderer::setBorders(const Borders& borders)
+    {
+        WidgetBorders::setBorders(borders);
+        m_textBox->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,396 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Widgets/ThreadedCanvas.hpp>
+
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The lowest bits of the mailbox contain the buffer index, the flag is set when the frame in it wasn't shown yet
+    const unsigned int bufferIndexMask = 0x3;
+    const unsigned int newFrameFlag = 0x4;
+
+    // Value of the mailbox when the render thread took the buffer from it and still has to publish a frame
+    const unsigned int emptyMailbox = 0x8;
+
+    // Value of m_backBuffer when the render thread has no buffer to render in
+    const unsigned int noBuffer = 0x8;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas::ThreadedCanvas(const Layout2d& size, unsigned int bufferCount) :
+        m_bufferCount    {bufferCount},
+        m_mailbox        {1},
+        m_stopRequested  {false},
+        m_frameRateLimit {60},
+        m_completedFrames{0}
+    {
+        if ((bufferCount != 2) && (bufferCount != 3))
+            throw Exception{"ThreadedCanvas requires 2 or 3 buffers, " + to_string(bufferCount) + " were requested."};
+
+        m_callback.widgetType = "ThreadedCanvas";
+
+        createBuffers();
+        setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas::ThreadedCanvas(const ThreadedCanvas& canvasToCopy) :
+        ClickableWidget  {canvasToCopy},
+        m_bufferCount    {canvasToCopy.m_bufferCount},
+        m_mailbox        {1},
+        m_renderFunction {canvasToCopy.m_renderFunction},
+        m_stopRequested  {false},
+        m_frameRateLimit {canvasToCopy.m_frameRateLimit.load()},
+        m_completedFrames{0}
+    {
+        // The sprite isn't copied, it would still point to a texture of the other canvas
+        m_sprite.setPosition(getPosition());
+        m_sprite.setColor(canvasToCopy.m_sprite.getColor());
+
+        createBuffers();
+        setSize(canvasToCopy.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas& ThreadedCanvas::operator= (const ThreadedCanvas& right)
+    {
+        if (this != &right)
+        {
+            stop();
+
+            ClickableWidget::operator=(right);
+
+            m_bufferCount = right.m_bufferCount;
+            m_renderFunction = right.m_renderFunction;
+            m_frameRateLimit = right.m_frameRateLimit.load();
+            m_completedFrames = 0;
+            m_sprite = sf::Sprite{};
+            m_sprite.setPosition(getPosition());
+            m_sprite.setColor(right.m_sprite.getColor());
+
+            createBuffers();
+            setSize(right.getSize());
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas::~ThreadedCanvas()
+    {
+        stop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas::Ptr ThreadedCanvas::create(Layout2d size, unsigned int bufferCount)
+    {
+        return makePooled<ThreadedCanvas>(size, bufferCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ThreadedCanvas::Ptr ThreadedCanvas::copy(ThreadedCanvas::ConstPtr canvas)
+    {
+        if (canvas)
+            return std::static_pointer_cast<ThreadedCanvas>(canvas->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::setPosition(const Layout2d& position)
+    {
+        Widget::setPosition(position);
+
+        m_sprite.setPosition(getPosition());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::setSize(const Layout2d& size)
+    {
+        Widget::setSize(size);
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_bufferSize = {std::max(1u, static_cast<unsigned int>(getSize().x)),
+                        std::max(1u, static_cast<unsigned int>(getSize().y))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::setRenderFunction(const RenderFunction& renderFunction)
+    {
+        if (isRunning())
+            throw Exception{"The render function of a ThreadedCanvas can't be changed while its render thread is running."};
+
+        m_renderFunction = renderFunction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::setFrameRateLimit(unsigned int limit)
+    {
+        m_frameRateLimit = limit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ThreadedCanvas::getFrameRateLimit() const
+    {
+        return m_frameRateLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ThreadedCanvas::getBufferCount() const
+    {
+        return m_bufferCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::start()
+    {
+        if (isRunning())
+            return;
+
+        if (!m_renderFunction)
+            throw Exception{"ThreadedCanvas can't be started without a render function."};
+
+        m_stopRequested = false;
+        m_thread = std::thread{&ThreadedCanvas::renderLoop, this};
+
+        scheduleUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::stop()
+    {
+        if (!isRunning())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stopRequested = true;
+        }
+        m_bufferReleased.notify_one();
+
+        m_thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThreadedCanvas::isRunning() const
+    {
+        return m_thread.joinable();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ThreadedCanvas::getCompletedFrameCount() const
+    {
+        return m_completedFrames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::setOpacity(float opacity)
+    {
+        Widget::setOpacity(opacity);
+
+        m_sprite.setColor({m_sprite.getColor().r, m_sprite.getColor().g, m_sprite.getColor().b, static_cast<sf::Uint8>(m_opacity * 255)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (m_mailbox.load() & newFrameFlag)
+            invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThreadedCanvas::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || isRunning();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::createBuffers()
+    {
+        m_buffers.clear();
+        for (unsigned int i = 0; i < m_bufferCount; ++i)
+            m_buffers.emplace_back(new sf::RenderTexture);
+
+        // The gui shows the first buffer and the second one is in the mailbox, with triple buffering the
+        // render thread starts with the third one. Nothing has been rendered in any of them yet.
+        m_frontBuffer = 0;
+        m_mailbox = 1;
+        m_backBuffer = (m_bufferCount == 3) ? 2 : noBuffer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::takeNewestFrame() const
+    {
+        if (!(m_mailbox.load() & newFrameFlag))
+            return;
+
+        // Put the buffer that was shown until now in the mailbox, so that the render thread can reuse it
+        m_frontBuffer = m_mailbox.exchange(m_frontBuffer) & bufferIndexMask;
+
+        // With double buffering the render thread may be waiting for the released buffer.
+        // Locking the mutex makes sure the thread isn't between checking the mailbox and starting to wait.
+        if (m_bufferCount == 2)
+        {
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+            }
+            m_bufferReleased.notify_one();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ThreadedCanvas::acquireBackBuffer()
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (!m_stopRequested)
+        {
+            unsigned int mailbox = m_mailbox.load();
+            if (!(mailbox & newFrameFlag) && (mailbox != emptyMailbox) && m_mailbox.compare_exchange_strong(mailbox, emptyMailbox))
+            {
+                m_backBuffer = mailbox;
+                return true;
+            }
+
+            m_bufferReleased.wait(lock);
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::renderLoop()
+    {
+        // Rendering on this thread requires an OpenGL context that is active on it
+        sf::Context context;
+
+        sf::RenderTexture* lastBuffer = nullptr;
+        auto frameStart = std::chrono::steady_clock::now();
+        while (!m_stopRequested)
+        {
+            if ((m_backBuffer == noBuffer) && !acquireBackBuffer())
+                break;
+
+            sf::Vector2u size;
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                size = m_bufferSize;
+            }
+
+            sf::RenderTexture& buffer = *m_buffers[m_backBuffer];
+            lastBuffer = &buffer;
+            if (buffer.getSize() != size)
+            {
+                if (!buffer.create(size.x, size.y))
+                    break;
+            }
+
+            m_renderFunction(buffer);
+            buffer.display();
+
+            // The gui thread may only use the texture after the commands that render it have been executed
+            glFinish();
+
+            // Publish the frame and continue with the buffer that was waiting in the mailbox, unless it was empty
+            const unsigned int previous = m_mailbox.exchange(m_backBuffer | newFrameFlag);
+            m_backBuffer = (previous == emptyMailbox) ? noBuffer : (previous & bufferIndexMask);
+            ++m_completedFrames;
+
+            const unsigned int frameRateLimit = m_frameRateLimit;
+            if (frameRateLimit > 0)
+            {
+                frameStart += std::chrono::microseconds{1000000 / frameRateLimit};
+
+                // Don't try to catch up when rendering took longer than the frame time
+                const auto now = std::chrono::steady_clock::now();
+                if (frameStart > now)
+                    std::this_thread::sleep_until(frameStart);
+                else
+                    frameStart = now;
+            }
+        }
+
+        // Don't leave the context of a buffer active on a thread that no longer exists
+        if (lastBuffer)
+            lastBuffer->setActive(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadedCanvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        takeNewestFrame();
+
+        const sf::RenderTexture& buffer = *m_buffers[m_frontBuffer];
+        if ((buffer.getSize().x == 0) || (buffer.getSize().y == 0))
+            return;
+
+        // The frame may have been rendered at a different size than the one the widget has now
+        m_sprite.setTexture(buffer.getTexture());
+        m_sprite.setTextureRect({0, 0,
+                                 static_cast<int>(std::min(buffer.getSize().x, static_cast<unsigned int>(getSize().x))),
+                                 static_cast<int>(std::min(buffer.getSize().y, static_cast<unsigned int>(getSize().y)))});
+
+        target.draw(m_sprite, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1006 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Widgets/devel/DataGrid.hpp>
+#include <TGUI/Clipping.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const float cellPadding = 3;
+
+    void addQuad(sf::VertexArray& vertices, const sf::FloatRect& rect, const sf::Color& color)
+    {
+        vertices.append({{rect.left, rect.top}, color});
+        vertices.append({{rect.left + rect.width, rect.top}, color});
+        vertices.append({{rect.left + rect.width, rect.top + rect.height}, color});
+        vertices.append({{rect.left, rect.top + rect.height}, color});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataGrid::DataGrid()
+    {
+        m_callback.widgetType = "DataGrid";
+        m_draggableWidget = true;
+
+        addSignal<int>("RowSelected");
+
+        setSize({400, 300});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataGrid::DataGrid(const DataGrid& gridToCopy) :
+        Widget                 {gridToCopy},
+        m_headers              (gridToCopy.m_headers),
+        m_columns              (gridToCopy.m_columns),
+        m_rowCount             {gridToCopy.m_rowCount},
+        m_fixedColumnWidths    (gridToCopy.m_fixedColumnWidths),
+        m_columnRatios         (gridToCopy.m_columnRatios),
+        m_columnWidths         (gridToCopy.m_columnWidths),
+        m_customRowHeights     (gridToCopy.m_customRowHeights),
+        m_rowHeight            {gridToCopy.m_rowHeight},
+        m_sortedRows           (gridToCopy.m_sortedRows),
+        m_shownRows            (gridToCopy.m_shownRows),
+        m_filter               (gridToCopy.m_filter),
+        m_rowOffsets           (gridToCopy.m_rowOffsets),
+        m_selectedRow          {gridToCopy.m_selectedRow},
+        m_hoveringRow          {-1},
+        m_textSize             {gridToCopy.m_textSize},
+        m_textColor            {gridToCopy.m_textColor},
+        m_headerTextColor      {gridToCopy.m_headerTextColor},
+        m_headerBackgroundColor{gridToCopy.m_headerBackgroundColor},
+        m_rowsOddColor         {gridToCopy.m_rowsOddColor},
+        m_rowsEvenColor        {gridToCopy.m_rowsEvenColor},
+        m_selectedRowColor     {gridToCopy.m_selectedRowColor},
+        m_hoveringRowColor     {gridToCopy.m_hoveringRowColor},
+        m_delimitatorColor     {gridToCopy.m_delimitatorColor},
+        m_scroll               {Scrollbar::copy(gridToCopy.m_scroll)},
+        m_headerTexts          (gridToCopy.m_headerTexts)
+    {
+        m_textCache.resize(m_columns.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataGrid& DataGrid::operator= (const DataGrid& right)
+    {
+        if (this != &right)
+        {
+            DataGrid temp{right};
+            Widget::operator=(right);
+
+            std::swap(m_headers,               temp.m_headers);
+            std::swap(m_columns,               temp.m_columns);
+            std::swap(m_rowCount,              temp.m_rowCount);
+            std::swap(m_fixedColumnWidths,     temp.m_fixedColumnWidths);
+            std::swap(m_columnRatios,          temp.m_columnRatios);
+            std::swap(m_columnWidths,          temp.m_columnWidths);
+            std::swap(m_customRowHeights,      temp.m_customRowHeights);
+            std::swap(m_rowHeight,             temp.m_rowHeight);
+            std::swap(m_sortedRows,            temp.m_sortedRows);
+            std::swap(m_shownRows,             temp.m_shownRows);
+            std::swap(m_filter,                temp.m_filter);
+            std::swap(m_rowOffsets,            temp.m_rowOffsets);
+            std::swap(m_selectedRow,           temp.m_selectedRow);
+            std::swap(m_hoveringRow,           temp.m_hoveringRow);
+            std::swap(m_textSize,              temp.m_textSize);
+            std::swap(m_textColor,             temp.m_textColor);
+            std::swap(m_headerTextColor,       temp.m_headerTextColor);
+            std::swap(m_headerBackgroundColor, temp.m_headerBackgroundColor);
+            std::swap(m_rowsOddColor,          temp.m_rowsOddColor);
+            std::swap(m_rowsEvenColor,         temp.m_rowsEvenColor);
+            std::swap(m_selectedRowColor,      temp.m_selectedRowColor);
+            std::swap(m_hoveringRowColor,      temp.m_hoveringRowColor);
+            std::swap(m_delimitatorColor,      temp.m_delimitatorColor);
+            std::swap(m_scroll,                temp.m_scroll);
+            std::swap(m_headerTexts,           temp.m_headerTexts);
+            std::swap(m_textCache,             temp.m_textCache);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataGrid::Ptr DataGrid::create()
+    {
+        return makePooled<DataGrid>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataGrid::Ptr DataGrid::copy(DataGrid::ConstPtr grid)
+    {
+        if (grid)
+            return std::static_pointer_cast<DataGrid>(grid->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setPosition(const Layout2d& position)
+    {
+        Widget::setPosition(position);
+
+        if (m_scroll != nullptr)
+            m_scroll->setPosition(getPosition().x + getSize().x - m_scroll->getSize().x, getPosition().y + getHeaderHeight());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setSize(const Layout2d& size)
+    {
+        Widget::setSize(size);
+
+        updateScrollbar();
+        updateColumnWidths();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setFont(const Font& font)
+    {
+        Widget::setFont(font);
+
+        updateRowHeight();
+        updateHeaderTexts();
+        clearTextCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setOpacity(float opacity)
+    {
+        Widget::setOpacity(opacity);
+
+        if (m_scroll != nullptr)
+            m_scroll->setOpacity(m_opacity);
+
+        updateHeaderTexts();
+        clearTextCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setTextSize(unsigned int size)
+    {
+        m_textSize = size;
+
+        updateRowHeight();
+        updateHeaderTexts();
+        clearTextCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DataGrid::getTextSize() const
+    {
+        return m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setHeaderColumns(const std::vector<std::string>& columns)
+    {
+        m_headers.assign(columns.begin(), columns.end());
+
+        // Make sure there is storage for every column in the header
+        if (m_columns.size() < m_headers.size())
+        {
+            m_columns.resize(m_headers.size(), std::vector<sf::String>(m_rowCount));
+            m_textCache.resize(m_headers.size());
+        }
+
+        updateHeaderTexts();
+        updateScrollbar();
+        updateColumnWidths();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::addRow(const std::vector<std::string>& columns)
+    {
+        // Previous rows get empty cells when the new row has more columns
+        if (m_columns.size() < columns.size())
+        {
+            m_columns.resize(columns.size(), std::vector<sf::String>(m_rowCount));
+            m_textCache.resize(columns.size());
+            updateColumnWidths();
+        }
+
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            if (i < columns.size())
+                m_columns[i].push_back(columns[i]);
+            else
+                m_columns[i].push_back("");
+        }
+
+        if (!m_customRowHeights.empty())
+            m_customRowHeights.push_back(0);
+
+        // The new row is shown at the bottom, until the rows are sorted again
+        m_sortedRows.push_back(m_rowCount);
+        if (!m_filter || m_filter(m_rowCount))
+        {
+            m_shownRows.push_back(m_rowCount);
+            if (!m_rowOffsets.empty())
+                m_rowOffsets.push_back(m_rowOffsets.back() + m_rowHeight);
+        }
+
+        ++m_rowCount;
+
+        updateScrollbar();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::removeAllRows()
+    {
+        for (auto& column : m_columns)
+            column.clear();
+
+        m_rowCount = 0;
+        m_customRowHeights.clear();
+        m_sortedRows.clear();
+        m_shownRows.clear();
+        m_rowOffsets.clear();
+        m_selectedRow = -1;
+        m_hoveringRow = -1;
+
+        clearTextCache();
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DataGrid::getColumnCount() const
+    {
+        return m_columns.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DataGrid::getRowCount() const
+    {
+        return m_rowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& DataGrid::getItem(std::size_t row, std::size_t column) const
+    {
+        assert(column < m_columns.size());
+        assert(row < m_rowCount);
+        return m_columns[column][row];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataGrid::changeItem(std::size_t row, std::size_t column, const sf::String& text)
+    {
+        if ((column >= m_columns.size()) || (row >= m_rowCount))
+            return false;
+
+        m_columns[column][row] = text;
+        m_textCache[column].erase(row);
+
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setFixedColumnWidth(std::size_t column, float size)
+    {
+        if (m_fixedColumnWidths.size() <= column)
+            m_fixedColumnWidths.resize(column + 1, 0);
+
+        m_fixedColumnWidths[column] = size;
+        updateColumnWidths();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setColumnRatio(std::size_t column, float ratio)
+    {
+        if (m_columnRatios.size() <= column)
+            m_columnRatios.resize(column + 1, 1);
+
+        m_columnRatios[column] = ratio;
+        updateColumnWidths();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setRowHeight(std::size_t row, float height)
+    {
+        if (row >= m_rowCount)
+            return;
+
+        if (m_customRowHeights.empty())
+        {
+            if (height <= 0)
+                return;
+
+            m_customRowHeights.resize(m_rowCount, 0);
+        }
+
+        m_customRowHeights[row] = std::max(0.f, height);
+
+        updateRowOffsets();
+        updateScrollbar();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DataGrid::getRowHeight(std::size_t row) const
+    {
+        if ((row < m_customRowHeights.size()) && (m_customRowHeights[row] > 0))
+            return m_customRowHeights[row];
+        else
+            return m_rowHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::sortByColumn(std::size_t column, bool ascending)
+    {
+        if (column >= m_columns.size())
+            return;
+
+        const std::vector<sf::String>& cells = m_columns[column];
+        if (ascending)
+            std::stable_sort(m_sortedRows.begin(), m_sortedRows.end(), [&cells](std::size_t left, std::size_t right){ return cells[left] < cells[right]; });
+        else
+            std::stable_sort(m_sortedRows.begin(), m_sortedRows.end(), [&cells](std::size_t left, std::size_t right){ return cells[right] < cells[left]; });
+
+        updateShownRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::sort(const std::function<bool(std::size_t, std::size_t)>& lessThan)
+    {
+        std::stable_sort(m_sortedRows.begin(), m_sortedRows.end(), lessThan);
+        updateShownRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setFilter(const std::function<bool(std::size_t)>& filter)
+    {
+        m_filter = filter;
+        updateShownRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::removeFilter()
+    {
+        setFilter(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::size_t>& DataGrid::getShownRows() const
+    {
+        return m_shownRows;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int DataGrid::getRowAtHeight(float y) const
+    {
+        if ((y < 0) || (y >= getTotalRowsHeight()))
+            return -1;
+
+        // When all rows have the same height then the row can be calculated directly,
+        // otherwise the row is searched in the prefix sums of the row heights.
+        std::size_t index;
+        if (m_rowOffsets.empty())
+            index = static_cast<std::size_t>(y / m_rowHeight);
+        else
+            index = static_cast<std::size_t>(std::upper_bound(m_rowOffsets.begin(), m_rowOffsets.end(), y) - m_rowOffsets.begin()) - 1;
+
+        if (index >= m_shownRows.size())
+            return -1;
+
+        return static_cast<int>(m_shownRows[index]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setSelectedRow(int row)
+    {
+        if ((row < 0) || (static_cast<std::size_t>(row) >= m_rowCount))
+            row = -1;
+
+        if (m_selectedRow != row)
+        {
+            m_selectedRow = row;
+            m_callback.value = row;
+            sendSignal("RowSelected", row);
+            invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int DataGrid::getSelectedRow() const
+    {
+        return m_selectedRow;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setRowsColor(const sf::Color& color)
+    {
+        m_rowsOddColor = color;
+        m_rowsEvenColor = sf::Color::Transparent;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setStripesRowsColor(const sf::Color& evenColor, const sf::Color& oddColor)
+    {
+        m_rowsOddColor = oddColor;
+        m_rowsEvenColor = evenColor;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setTextColor(const sf::Color& color)
+    {
+        m_textColor = color;
+        clearTextCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setHeaderColor(const sf::Color& backgroundColor, const sf::Color& textColor)
+    {
+        m_headerBackgroundColor = backgroundColor;
+        m_headerTextColor = textColor;
+
+        updateHeaderTexts();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setSelectedRowColor(const sf::Color& color)
+    {
+        m_selectedRowColor = color;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setHoveringRowColor(const sf::Color& color)
+    {
+        m_hoveringRowColor = color;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::setScrollbar(Scrollbar::Ptr scrollbar)
+    {
+        m_scroll = scrollbar;
+
+        updateScrollbar();
+        updateColumnWidths();
+        updatePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Scrollbar::Ptr DataGrid::getScrollbar() const
+    {
+        return m_scroll;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataGrid::mouseOnWidget(float x, float y) const
+    {
+        return sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::leftMousePressed(float x, float y)
+    {
+        m_mouseDown = true;
+
+        // If there is a scrollbar then pass the event
+        if ((m_scroll != nullptr) && m_scroll->mouseOnWidget(x, y))
+        {
+            m_scroll->leftMousePressed(x, y);
+            invalidate();
+            return;
+        }
+
+        const float headerHeight = getHeaderHeight();
+        if (y - getPosition().y >= headerHeight)
+            setSelectedRow(getRowAtHeight(y - getPosition().y - headerHeight + getScrollbarValue()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::leftMouseReleased(float x, float y)
+    {
+        if (m_scroll != nullptr)
+        {
+            const unsigned int oldValue = m_scroll->getValue();
+            m_scroll->leftMouseReleased(x, y);
+
+            // Scroll with the height of a row instead of a single pixel when pressing the arrows
+            const unsigned int rowHeight = static_cast<unsigned int>(m_rowHeight);
+            if (m_scroll->getValue() == oldValue + 1)
+                m_scroll->setValue(oldValue + rowHeight);
+            else if ((m_scroll->getValue() + 1 == oldValue) && (oldValue > rowHeight))
+                m_scroll->setValue(oldValue - rowHeight);
+            else if (m_scroll->getValue() + 1 == oldValue)
+                m_scroll->setValue(0);
+
+            if (m_scroll->getValue() != oldValue)
+                invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::mouseMoved(float x, float y)
+    {
+        if (!m_mouseHover)
+            mouseEnteredWidget();
+
+        if (m_scroll != nullptr)
+        {
+            // Check if you are dragging the thumb of the scrollbar
+            if (m_scroll->m_mouseDown && m_scroll->m_mouseDownOnThumb)
+            {
+                m_scroll->mouseMoved(x, y);
+                invalidate();
+                return;
+            }
+
+            if (m_scroll->mouseOnWidget(x, y))
+            {
+                m_scroll->mouseMoved(x, y);
+                m_hoveringRow = -1;
+                return;
+            }
+            else
+                m_scroll->m_mouseHover = false;
+        }
+
+        const float headerHeight = getHeaderHeight();
+        if (y - getPosition().y >= headerHeight)
+            m_hoveringRow = getRowAtHeight(y - getPosition().y - headerHeight + getScrollbarValue());
+        else
+            m_hoveringRow = -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::mouseWheelMoved(int delta, int x, int y)
+    {
+        if ((m_scroll == nullptr) || (m_scroll->getLowValue() >= m_scroll->getMaximum()))
+            return;
+
+        const unsigned int change = static_cast<unsigned int>(std::abs(delta) * m_rowHeight);
+        if (delta < 0)
+            m_scroll->setValue(m_scroll->getValue() + change);
+        else if (change < m_scroll->getValue())
+            m_scroll->setValue(m_scroll->getValue() - change);
+        else
+            m_scroll->setValue(0);
+
+        mouseMoved(static_cast<float>(x), static_cast<float>(y));
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::mouseNoLongerOnWidget()
+    {
+        if (m_mouseHover)
+            mouseLeftWidget();
+
+        if (m_scroll != nullptr)
+            m_scroll->m_mouseHover = false;
+
+        if (m_hoveringRow != -1)
+        {
+            m_hoveringRow = -1;
+            invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::mouseNoLongerDown()
+    {
+        Widget::mouseNoLongerDown();
+
+        if (m_scroll != nullptr)
+            m_scroll->mouseNoLongerDown();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateShownRows()
+    {
+        m_shownRows.clear();
+        if (m_filter)
+        {
+            for (std::size_t row : m_sortedRows)
+            {
+                if (m_filter(row))
+                    m_shownRows.push_back(row);
+            }
+        }
+        else
+            m_shownRows = m_sortedRows;
+
+        m_hoveringRow = -1;
+
+        // Other rows may now be visible, so make sure the text cache gets cleaned up during the next draw
+        m_cachedFirstRow = 0;
+        m_cachedLastRow = 0;
+
+        updateRowOffsets();
+        updateScrollbar();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateRowOffsets()
+    {
+        m_rowOffsets.clear();
+        if (m_customRowHeights.empty())
+            return;
+
+        m_rowOffsets.reserve(m_shownRows.size() + 1);
+        m_rowOffsets.push_back(0);
+        for (std::size_t row : m_shownRows)
+            m_rowOffsets.push_back(m_rowOffsets.back() + getRowHeight(row));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DataGrid::getShownRowOffset(std::size_t index) const
+    {
+        if (m_rowOffsets.empty())
+            return index * m_rowHeight;
+        else
+            return m_rowOffsets[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DataGrid::getTotalRowsHeight() const
+    {
+        return getShownRowOffset(m_shownRows.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateRowHeight()
+    {
+        if (m_font == nullptr)
+            return;
+
+        m_rowHeight = std::ceil(m_font->getLineSpacing(m_textSize) + 2 * cellPadding);
+
+        updateRowOffsets();
+        updateScrollbar();
+        updatePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateColumnWidths()
+    {
+        float availableWidth = getSize().x;
+        if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
+            availableWidth -= m_scroll->getSize().x;
+
+        // Columns with a fixed width get their width first, the remaining space is divided based on the ratios
+        float totalRatio = 0;
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            if ((i < m_fixedColumnWidths.size()) && (m_fixedColumnWidths[i] > 0))
+                availableWidth -= m_fixedColumnWidths[i];
+            else
+                totalRatio += (i < m_columnRatios.size()) ? m_columnRatios[i] : 1;
+        }
+
+        availableWidth = std::max(0.f, availableWidth);
+
+        m_columnWidths.resize(m_columns.size());
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            if ((i < m_fixedColumnWidths.size()) && (m_fixedColumnWidths[i] > 0))
+                m_columnWidths[i] = m_fixedColumnWidths[i];
+            else if (totalRatio > 0)
+                m_columnWidths[i] = availableWidth * ((i < m_columnRatios.size()) ? m_columnRatios[i] : 1) / totalRatio;
+            else
+                m_columnWidths[i] = 0;
+        }
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateScrollbar()
+    {
+        if (m_scroll == nullptr)
+            return;
+
+        const bool scrollbarWasShown = (m_scroll->getLowValue() < m_scroll->getMaximum());
+
+        const float rowsAreaHeight = std::max(0.f, getSize().y - getHeaderHeight());
+        m_scroll->setSize({m_scroll->getSize().x, rowsAreaHeight});
+        m_scroll->setLowValue(static_cast<unsigned int>(rowsAreaHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(std::ceil(getTotalRowsHeight())));
+        m_scroll->setPosition(getPosition().x + getSize().x - m_scroll->getSize().x, getPosition().y + getHeaderHeight());
+
+        // The columns have to become narrower or wider when the scrollbar appears or disappears
+        if (scrollbarWasShown != (m_scroll->getLowValue() < m_scroll->getMaximum()))
+            updateColumnWidths();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::updateHeaderTexts()
+    {
+        m_headerTexts.clear();
+        if (m_font == nullptr)
+            return;
+
+        for (const auto& header : m_headers)
+        {
+            m_headerTexts.emplace_back(header, *m_font, m_textSize);
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            m_headerTexts.back().setFillColor(calcColorOpacity(m_headerTextColor, getOpacity()));
+#else
+            m_headerTexts.back().setColor(calcColorOpacity(m_headerTextColor, getOpacity()));
+#endif
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::clearTextCache()
+    {
+        for (auto& columnCache : m_textCache)
+            columnCache.clear();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DataGrid::getHeaderHeight() const
+    {
+        if (m_headers.empty())
+            return 0;
+        else
+            return m_rowHeight + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DataGrid::getScrollbarValue() const
+    {
+        if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
+            return m_scroll->getValue();
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataGrid::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        const sf::RenderStates scrollbarStates = states;
+        states.transform.translate(getPosition());
+
+        const float headerHeight = getHeaderHeight();
+        const float rowsAreaHeight = std::max(0.f, getSize().y - headerHeight);
+
+        float rowsAreaWidth = getSize().x;
+        if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
+            rowsAreaWidth -= m_scroll->getSize().x;
+
+        // Draw the header
+        if (headerHeight > 0)
+        {
+            sf::RectangleShape header{{getSize().x, headerHeight - 1}};
+            header.setFillColor(calcColorOpacity(m_headerBackgroundColor, getOpacity()));
+            target.draw(header, states);
+
+            float left = 0;
+            for (std::size_t i = 0; (i < m_headerTexts.size()) && (i < m_columnWidths.size()); ++i)
+            {
+                Clipping clipping{target, states, {left, 0}, {m_columnWidths[i], headerHeight}};
+
+                sf::RenderStates textStates = states;
+                textStates.transform.translate(std::round(left + cellPadding), std::round(cellPadding));
+                target.draw(m_headerTexts[i], textStates);
+
+                left += m_columnWidths[i];
+            }
+        }
+
+        // Find out which rows are visible. Only these rows are drawn, no matter how many rows the grid contains.
+        const float scrollOffset = static_cast<float>(getScrollbarValue());
+        std::size_t firstRow = 0;
+        std::size_t lastRow = 0;
+        if (!m_shownRows.empty())
+        {
+            if (m_rowOffsets.empty())
+            {
+                firstRow = static_cast<std::size_t>(scrollOffset / m_rowHeight);
+                lastRow = static_cast<std::size_t>(std::ceil((scrollOffset + rowsAreaHeight) / m_rowHeight));
+            }
+            else
+            {
+                firstRow = static_cast<std::size_t>(std::upper_bound(m_rowOffsets.begin(), m_rowOffsets.end(), scrollOffset) - m_rowOffsets.begin()) - 1;
+                lastRow = static_cast<std::size_t>(std::lower_bound(m_rowOffsets.begin(), m_rowOffsets.end(), scrollOffset + rowsAreaHeight) - m_rowOffsets.begin());
+            }
+
+            lastRow = std::min(lastRow, m_shownRows.size());
+            firstRow = std::min(firstRow, lastRow);
+        }
+
+        // Forget the text of the rows that scrolled out of view. The text of the visible rows is moved to a new cache,
+        // so that the work only depends on the amount of visible rows and not on the size of the old cache.
+        if ((firstRow != m_cachedFirstRow) || (lastRow != m_cachedLastRow))
+        {
+            for (auto& columnCache : m_textCache)
+            {
+                std::unordered_map<std::size_t, sf::Text> visibleCache;
+                for (std::size_t i = firstRow; (i < lastRow) && !columnCache.empty(); ++i)
+                {
+                    const auto it = columnCache.find(m_shownRows[i]);
+                    if (it != columnCache.end())
+                    {
+                        visibleCache.emplace(it->first, std::move(it->second));
+                        columnCache.erase(it);
+                    }
+                }
+
+                columnCache.swap(visibleCache);
+            }
+
+            m_cachedFirstRow = firstRow;
+            m_cachedLastRow = lastRow;
+        }
+
+        states.transform.translate(0, headerHeight - scrollOffset);
+        Clipping clipping{target, states, {0, scrollOffset}, {rowsAreaWidth, rowsAreaHeight}};
+
+        // Draw the backgrounds of all visible rows at once
+        sf::VertexArray backgrounds{sf::Quads};
+        for (std::size_t i = firstRow; i < lastRow; ++i)
+        {
+            const std::size_t row = m_shownRows[i];
+
+            sf::Color color;
+            if (static_cast<int>(row) == m_selectedRow)
+                color = m_selectedRowColor;
+            else if ((static_cast<int>(row) == m_hoveringRow) && (m_hoveringRowColor != sf::Color::Transparent))
+                color = m_hoveringRowColor;
+            else if ((m_rowsEvenColor != sf::Color::Transparent) && (i % 2 == 0))
+                color = m_rowsEvenColor;
+            else
+                color = m_rowsOddColor;
+
+            if (color != sf::Color::Transparent)
+                addQuad(backgrounds, {0, getShownRowOffset(i), rowsAreaWidth, getRowHeight(row)}, calcColorOpacity(color, getOpacity()));
+        }
+        target.draw(backgrounds, states);
+
+        // Draw the cells column by column, reusing the text of cells that were already visible
+        if (m_font != nullptr)
+        {
+            float left = 0;
+            for (std::size_t column = 0; column < m_columns.size(); ++column)
+            {
+                const float width = (column < m_columnWidths.size()) ? m_columnWidths[column] : 0;
+                if (width <= 0)
+                    continue;
+
+                Clipping columnClipping{target, states, {left, scrollOffset}, {width, rowsAreaHeight}};
+
+                auto& columnCache = m_textCache[column];
+                for (std::size_t i = firstRow; i < lastRow; ++i)
+                {
+                    const std::size_t row = m_shownRows[i];
+
+                    auto it = columnCache.find(row);
+                    if (it == columnCache.end())
+                    {
+                        it = columnCache.emplace(row, sf::Text{m_columns[column][row], *m_font, m_textSize}).first;
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                        it->second.setFillColor(calcColorOpacity(m_textColor, getOpacity()));
+#else
+                        it->second.setColor(calcColorOpacity(m_textColor, getOpacity()));
+#endif
+                    }
+
+                    sf::RenderStates textStates = states;
+                    textStates.transform.translate(std::round(left + cellPadding), std::round(getShownRowOffset(i) + (getRowHeight(row) - m_rowHeight) / 2 + cellPadding));
+                    target.draw(it->second, textStates);
+                }
+
+                left += width;
+            }
+        }
+
+        // Draw the lines between the columns
+        sf::VertexArray delimitators{sf::Lines};
+        float left = 0;
+        for (std::size_t column = 0; column + 1 < m_columnWidths.size(); ++column)
+        {
+            left += m_columnWidths[column];
+            delimitators.append({{std::round(left), scrollOffset}, calcColorOpacity(m_delimitatorColor, getOpacity())});
+            delimitators.append({{std::round(left), scrollOffset + rowsAreaHeight}, calcColorOpacity(m_delimitatorColor, getOpacity())});
+        }
+        target.draw(delimitators, states);
+
+        // Draw the scrollbar
+        if (m_scroll != nullptr)
+            target.draw(*m_scroll, scrollbarStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,52 +27,6 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace
-{
-    struct Chunk
-    {
-        Chunk()
-        {
-            style = sf::Text::Regular;
-            color = sf::Color::White;
-            endsInNewline = false;
-        }
-
-        sf::String text;
-        unsigned int style;
-        sf::Color color;
-        bool endsInNewline;
-    };
-
-    void newChunk(std::vector<Chunk>& chunks, Chunk*& currentChunk, Chunk& lastChunk)
-    {
-        chunks.push_back(Chunk());
-        currentChunk = &(chunks[chunks.size() - 1]);
-
-        // only carry information over if currentChunk and lastChunk aren't the same
-        // this only happens for the first chunk, but it causes random errors
-        if (chunks.size() > 2)
-        {
-            currentChunk->style = lastChunk.style;
-            currentChunk->color = lastChunk.color;
-        }
-    }
-
-    void processFormatting(Chunk& lastChunk, Chunk* currentChunk, sf::Text::Style style)
-    {
-        if ((lastChunk.style & style) != 0)
-        {
-            currentChunk->style ^= style;
-        }
-        else
-        {
-            currentChunk->style |= style;
-        }
-    }
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,7 +73,6 @@ namespace tgui
     {
         Widget::setPosition(position);
         m_background.setPosition(getPosition());
-        setText(m_string);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +86,9 @@ namespace tgui
     void RichTextLabel::setFont(const Font& font)
     {
         Widget::setFont(font);
-        setText(m_string);
+        updateVertices();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,180 +96,11 @@ namespace tgui
     void RichTextLabel::setText(const sf::String& string)
     {
         m_string = string;
+        m_richText = RichText{m_string, m_colors, m_colors["default"]};
 
-        if (!m_font)
-            return;
-
-        m_texts.clear();
-
-        std::vector<Chunk> chunks;
-        chunks.push_back(Chunk());
-
-        Chunk* currentChunk = &(chunks[0]);
-        bool escaped = false;
+        updateVertices();
 
-        for (std::size_t i = 0; i < m_string.getSize(); ++i)
-        {
-            Chunk& lastChunk = *currentChunk;
-
-            switch (m_string[i])
-            {
-                case '~': // italics
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Italic);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '*': // bold
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Bold);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '_': // underline
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    newChunk(chunks, currentChunk, lastChunk);
-
-
-                    processFormatting(lastChunk, currentChunk, sf::Text::Underlined);
-
-                    currentChunk->color = lastChunk.color;
-                    break;
-                }
-                case '#': // color
-                {
-                    if (escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                        escaped = false;
-                        break;
-                    }
-
-                    // seek forward until the next whitespace
-                    std::size_t length = 0;
-                    while (!isspace(m_string[++i]))
-                        ++length;
-
-                    newChunk(chunks, currentChunk, lastChunk);
-                    currentChunk->color = getColor(m_string.substring(i + 1, length));;
-                    break;
-
-                }
-                case '\\': // escape sequence for escaping formatting characters
-                {
-                    if (i < m_string.getSize())
-                    {
-                        switch (m_string[i + 1])
-                        {
-                            case '~':
-                            case '*':
-                            case '_':
-                            case '#':
-                            {
-                                escaped = true;
-                                break;
-                            }
-                            default:
-                                break;
-                        }
-                    }
-
-                    if (!escaped)
-                    {
-                        currentChunk->text += m_string[i];
-                    }
-
-                    break;
-                }
-                case '\n': // make a new chunk in the case of a newline
-                {
-                    currentChunk->endsInNewline = true;
-                    newChunk(chunks, currentChunk, lastChunk);
-                    break;
-                }
-                default:
-                {
-                    escaped = false;
-                    currentChunk->text += m_string[i];
-                    break;
-                }
-            }
-        }
-
-        sf::String totalString = "";
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-        {
-            if (!chunks[i].endsInNewline && chunks[i].text.getSize() == 0)
-            {
-                continue;
-            }
-
-            totalString += chunks[i].text + (chunks[i].endsInNewline ? "\n" : "");
-        }
-
-        sf::Text text;
-        text.setString(totalString);
-        text.setCharacterSize(m_textSize);
-        text.setPosition(getPosition());
-        text.setFont(*m_font);
-
-        m_size = {text.getLocalBounds().left + text.getLocalBounds().width, text.getLocalBounds().top + text.getLocalBounds().height};
-        m_background.setSize(getSize());
-
-        std::size_t cursor = 0;
-        Chunk* lastChunk = nullptr;
-        for (std::size_t i = 0; i < chunks.size(); ++i)
-        {
-            sf::Text tempText;
-#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-            tempText.setFillColor(chunks[i].color);
-#else
-            tempText.setColor(chunks[i].color);
-#endif
-            tempText.setString(chunks[i].text);
-            tempText.setStyle(chunks[i].style);
-            tempText.setCharacterSize(m_textSize);
-            tempText.setFont(*m_font);
-
-            tempText.setPosition(text.findCharacterPos(cursor));
-
-            if (lastChunk != nullptr && lastChunk->endsInNewline)
-            {
-                tempText.setPosition(0, tempText.getPosition().y + m_font->getLineSpacing(m_textSize));
-                ++cursor;
-            }
-
-            m_texts.push_back(tempText);
-            cursor += chunks[i].text.getSize();
-            lastChunk = &chunks[i];
-        }
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,7 +108,9 @@ namespace tgui
     void RichTextLabel::setTextSize(unsigned int size)
     {
         m_textSize = size;
-        setText(m_string);
+        updateVertices();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,6 +125,8 @@ namespace tgui
     void RichTextLabel::setBackgroundColor(const sf::Color& color)
     {
         m_background.setFillColor(color);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,20 +154,7 @@ namespace tgui
 
     sf::Color RichTextLabel::getColor(const sf::String& source) const
     {
-        std::map<sf::String, sf::Color>::const_iterator result = m_colors.find(source);
-        if (result == m_colors.end())
-        {
-            unsigned int hex = 0x0;
-            if (!(std::istringstream(source) >> std::hex >> hex))
-            {
-                // Error parsing; return default
-                return sf::Color::White;
-            };
-
-            return getColor(hex);
-        }
-
-        return result->second;
+        return RichText::findColor(source, m_colors);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -395,8 +172,27 @@ namespace tgui
         if (m_background.getFillColor() != sf::Color::Transparent)
             target.draw(m_background, states);
 
-        for(std::size_t i = 0; i < m_texts.size(); ++i)
-            target.draw(m_texts[i], states);
+        if (!m_vertices.empty())
+        {
+            states.transform.translate(getPosition());
+            states.texture = &m_font->getTexture(m_textSize);
+            target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::updateVertices()
+    {
+        // The size of the label changes with its text, so the area where the old text was located has to be redrawn as well
+        invalidate();
+
+        m_vertices.clear();
+        if (!m_font)
+            return;
+
+        m_size = m_richText.createVertices(*m_font, m_textSize, m_vertices);
+        m_background.setSize(getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,7 +90,7 @@ namespace tgui
         auto row = std::dynamic_pointer_cast<TableRow>(widget);
         if (row == nullptr)
         {
-            row = std::make_shared<tgui::TableRow>();
+            row = tgui::makePooled<tgui::TableRow>();
             row->add(widget);
         }
 
@@ -124,7 +124,7 @@ namespace tgui
 
     void Table::addRow(const std::vector<std::string>& columns)
     {
-        auto row = std::make_shared<TableRow>();
+        auto row = makePooled<TableRow>();
         for (const std::string& column : columns)
             row->addItem(column, m_normalTextColor);
 
@@ -244,7 +244,7 @@ namespace tgui
 
     void Table::calculateLabelHeight()
     {
-        auto label = std::make_shared<Label>();
+        auto label = makePooled<Label>();
         label->setFont(getFont());
         label->setTextSize(m_characterSize);
 
@@ -155,11 +155,11 @@ namespace tgui
 
     TableItem::Ptr TableRow::createItem(const std::string& name, TableItem::HorizontalAlign align, const sf::Color& color)
     {
-        auto label = std::make_shared<tgui::Label>();
+        auto label = tgui::makePooled<tgui::Label>();
         label->setText(name);
         label->setTextColor(color);
 
-        auto layout = std::make_shared<tgui::TableItem>();
+        auto layout = tgui::makePooled<tgui::TableItem>();
         layout->setItem(label, (align == TableItem::None) ? m_align : align);
 
         return layout;
@@ -172,7 +172,7 @@ namespace tgui
         if (fixedHeight && widget->getFullSize().y > m_customHeight)
             m_customHeight = widget->getFullSize().y;
 
-        auto layout = std::make_shared<tgui::TableItem>();
+        auto layout = tgui::makePooled<tgui::TableItem>();
         layout->setItem(widget, align);
 
         return layout;
@@ -199,4 +199,32 @@ TEST_CASE("[Animation]") {
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Updates are only scheduled while animating") {
+        // The update functions of containers are only accessible through the base class
+        tgui::Widget::Ptr container = parent;
+
+        REQUIRE(!widget->isUpdateRequired());
+        REQUIRE(!container->isUpdateRequired());
+
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(widget->isUpdateRequired());
+        REQUIRE(container->isUpdateRequired());
+
+        // The parent passes the time to the animating widget
+        container->update(sf::milliseconds(100));
+        REQUIRE(tgui::compareFloats(widget->getOpacity(), 0.3f));
+
+        container->update(sf::milliseconds(200));
+        REQUIRE(widget->getOpacity() == 0.9f);
+        REQUIRE(!widget->isUpdateRequired());
+        REQUIRE(!container->isUpdateRequired());
+
+        // A widget that is removed during its animation is no longer updated by the parent
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        parent->remove(widget);
+        REQUIRE(!container->isUpdateRequired());
+        container->update(sf::milliseconds(100));
+        REQUIRE(widget->getOpacity() == 0);
+    }
 }
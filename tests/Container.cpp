@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
 
 TEST_CASE("[Container]") {
     auto container = std::make_shared<tgui::Gui>();
@@ -236,4 +239,199 @@ TEST_CASE("[Container]") {
         REQUIRE(widget4->getOpacity() == 0.7f);
         REQUIRE(widget5->getOpacity() == 0.7f);
     }
+
+    SECTION("dirty area") {
+        sf::RenderTexture texture;
+        texture.create(200, 100);
+        tgui::Gui gui{texture};
+
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect(0, 0, 200, 100));
+
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect());
+
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setPosition(10, 20);
+        panel->setSize(30, 40);
+        gui.add(panel);
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect(10, 20, 30, 40));
+
+        gui.drawDirtyArea();
+        REQUIRE(!gui.needsRedraw());
+
+        panel->setPosition(50, 30);
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect(10, 20, 70, 50));
+        gui.draw();
+
+        auto child = std::make_shared<tgui::Panel>();
+        child->setPosition(5, 5);
+        child->setSize(10, 10);
+        panel->add(child);
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect(55, 35, 10, 10));
+        gui.draw();
+
+        panel->hide();
+        REQUIRE(gui.getDirtyArea() == sf::FloatRect(50, 30, 30, 40));
+        gui.draw();
+
+        child->setPosition(0, 0);
+        REQUIRE(!gui.needsRedraw());
+    }
+
+    SECTION("dirty area of renderers and popups") {
+        sf::RenderTexture texture;
+        texture.create(400, 300);
+        tgui::Gui gui{texture};
+        gui.setFont("resources/DroidSansArmenian.ttf");
+
+        auto containsArea = [](const sf::FloatRect& area, const sf::FloatRect& part){
+            return (area.left <= part.left) && (area.top <= part.top)
+                && (area.left + area.width >= part.left + part.width) && (area.top + area.height >= part.top + part.height);
+        };
+
+        auto sendMouseEvent = [&](sf::Event::EventType type, int x, int y){
+            sf::Event event;
+            event.type = type;
+            if (type == sf::Event::MouseMoved)
+            {
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+            }
+            else
+            {
+                event.mouseButton.button = sf::Mouse::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+            }
+            gui.handleEvent(event);
+        };
+
+        SECTION("renderer") {
+            auto button = std::make_shared<tgui::Button>();
+            button->setPosition(10, 20);
+            button->setSize(30, 40);
+            gui.add(button);
+            gui.draw();
+            REQUIRE(!gui.needsRedraw());
+
+            button->getRenderer()->setBackgroundColorNormal(sf::Color::Red);
+            REQUIRE(gui.needsRedraw());
+            REQUIRE(containsArea(gui.getDirtyArea(), {10, 20, 30, 40}));
+        }
+
+        SECTION("MenuBar") {
+            auto menuBar = std::make_shared<tgui::MenuBar>();
+            menuBar->setSize(400, 20);
+            menuBar->addMenu("File");
+            menuBar->addMenuItem("Load");
+            menuBar->addMenuItem("Save");
+            gui.add(menuBar);
+            gui.draw();
+
+            // The open menu is drawn below the menu bar
+            sendMouseEvent(sf::Event::MouseButtonPressed, 5, 5);
+            sendMouseEvent(sf::Event::MouseButtonReleased, 5, 5);
+            REQUIRE(containsArea(gui.getDirtyArea(), {0, 20, 125, 40}));
+            gui.draw();
+
+            // The area of the menu also has to be redrawn when it is closed
+            menuBar->closeMenu();
+            REQUIRE(containsArea(gui.getDirtyArea(), {0, 20, 125, 40}));
+        }
+
+        SECTION("ComboBox") {
+            auto panel = std::make_shared<tgui::Panel>();
+            panel->setPosition(50, 50);
+            panel->setSize(200, 50);
+            panel->setRenderCacheEnabled(true);
+            gui.add(panel);
+
+            auto comboBox = std::make_shared<tgui::ComboBox>();
+            comboBox->setPosition(10, 10);
+            comboBox->setSize(150, 24);
+            comboBox->addItem("1");
+            comboBox->addItem("2");
+            comboBox->addItem("3");
+            panel->add(comboBox);
+            gui.draw();
+
+            // The list is added to the gui, so it reports its area in gui coordinates even though it is outside the panel
+            sendMouseEvent(sf::Event::MouseButtonPressed, 70, 70);
+            sendMouseEvent(sf::Event::MouseButtonReleased, 70, 70);
+            auto listBox = gui.get("#TGUI_INTERNAL$ComboBoxListBox#");
+            REQUIRE(listBox != nullptr);
+            const float listBoxBottom = listBox->getPosition().y + listBox->getSize().y;
+            REQUIRE(listBoxBottom > 100);
+            REQUIRE(containsArea(gui.getDirtyArea(), {listBox->getPosition(), listBox->getSize()}));
+            gui.draw();
+
+            const sf::FloatRect listBoxArea{listBox->getPosition(), listBox->getSize()};
+            sendMouseEvent(sf::Event::MouseButtonPressed, 70, 70);
+            sendMouseEvent(sf::Event::MouseButtonReleased, 70, 70);
+            REQUIRE(gui.get("#TGUI_INTERNAL$ComboBoxListBox#") == nullptr);
+            REQUIRE(containsArea(gui.getDirtyArea(), listBoxArea));
+        }
+
+        SECTION("ToolTip") {
+            auto button = std::make_shared<tgui::Button>();
+            button->setPosition(10, 20);
+            button->setSize(30, 40);
+            auto toolTip = std::make_shared<tgui::Label>();
+            toolTip->setText("ToolTip");
+            button->setToolTip(toolTip);
+            gui.add(button);
+
+            sendMouseEvent(sf::Event::MouseMoved, 20, 30);
+            gui.draw();
+
+            gui.updateTime(tgui::ToolTip::getTimeToDisplay());
+            REQUIRE(gui.get("#TGUI_INTERNAL$ToolTip#") == toolTip);
+            REQUIRE(containsArea(gui.getDirtyArea(), {toolTip->getPosition(), toolTip->getSize()}));
+            gui.draw();
+
+            const sf::FloatRect toolTipArea{toolTip->getPosition(), toolTip->getSize()};
+            sendMouseEvent(sf::Event::MouseMoved, 21, 30);
+            REQUIRE(gui.get("#TGUI_INTERNAL$ToolTip#") == nullptr);
+            REQUIRE(containsArea(gui.getDirtyArea(), toolTipArea));
+        }
+    }
+
+    SECTION("saveWidgetsToFile keeps the existing file when saving fails") {
+        // Restores the original save function, also when a REQUIRE fails
+        struct SaveFunctionGuard
+        {
+            SaveFunctionGuard() : saveFunction(tgui::WidgetSaver::getSaveFunction("editbox")) {}
+            ~SaveFunctionGuard()
+            {
+                tgui::WidgetSaver::setSaveFunction("editbox", saveFunction);
+                std::remove("WidgetFileContainer1.txt");
+            }
+
+            tgui::WidgetSaver::SaveFunction saveFunction;
+        } guard;
+
+        std::ofstream{"WidgetFileContainer1.txt"} << "Original contents";
+
+        auto parent = std::make_shared<tgui::Panel>();
+        parent->add(std::make_shared<tgui::EditBox>());
+        tgui::WidgetSaver::setSaveFunction("editbox", [](tgui::WidgetConverter) -> std::shared_ptr<tgui::DataIO::Node> {
+            throw tgui::Exception{"Failed to save widget"};
+        });
+        REQUIRE_THROWS_AS(parent->saveWidgetsToFile("WidgetFileContainer1.txt"), tgui::Exception);
+
+        std::stringstream contents;
+        contents << std::ifstream{"WidgetFileContainer1.txt"}.rdbuf();
+        REQUIRE(contents.str() == "Original contents");
+        REQUIRE(!std::ifstream{"WidgetFileContainer1.txt.tmp"}.is_open());
+
+        tgui::WidgetSaver::setSaveFunction("editbox", guard.saveFunction);
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileContainer1.txt"));
+        contents.str("");
+        contents << std::ifstream{"WidgetFileContainer1.txt"}.rdbuf();
+        REQUIRE(contents.str().find("EditBox") != std::string::npos);
+        REQUIRE(!std::ifstream{"WidgetFileContainer1.txt.tmp"}.is_open());
+    }
 }
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[DistanceFieldFont]") {
+    std::shared_ptr<sf::Font> font = tgui::Font{"resources/DroidSansArmenian.ttf"}.getFont();
+    REQUIRE(font != nullptr);
+
+    SECTION("Glyphs") {
+        auto distanceFieldFont = std::make_shared<tgui::DistanceFieldFont>(font, 32, 4);
+        REQUIRE(distanceFieldFont->getReferenceSize() == 32);
+        REQUIRE(distanceFieldFont->getSpread() == 4);
+
+        const auto& glyph = distanceFieldFont->getGlyph('A', false);
+        REQUIRE(glyph.advance > 0);
+        REQUIRE(glyph.bounds.width > 0);
+        REQUIRE(glyph.bounds.height > 0);
+        REQUIRE(glyph.textureRect.width > 8);
+        REQUIRE(glyph.textureRect.left + glyph.textureRect.width <= distanceFieldFont->getTexture().getSize().x);
+        REQUIRE(glyph.textureRect.top + glyph.textureRect.height <= distanceFieldFont->getTexture().getSize().y);
+
+        // Metrics are given for a character size of 1
+        REQUIRE(glyph.advance == Approx(font->getGlyph('A', 32, false).advance / 32.f));
+
+        // Glyphs are only added once
+        REQUIRE(&distanceFieldFont->getGlyph('A', false) == &glyph);
+        REQUIRE(&distanceFieldFont->getGlyph('A', true) != &glyph);
+
+        // Whitespace has nothing to draw
+        REQUIRE(distanceFieldFont->getGlyph(' ', false).advance > 0);
+        REQUIRE(distanceFieldFont->getGlyph(' ', false).textureRect.width == 0);
+
+        // The spread around the glyph is outside of it, the solid part of the atlas is inside
+        const sf::Image atlas = distanceFieldFont->getTexture().copyToImage();
+        REQUIRE(atlas.getPixel(static_cast<unsigned int>(glyph.textureRect.left), static_cast<unsigned int>(glyph.textureRect.top)).a < 128);
+        REQUIRE(atlas.getPixel(static_cast<unsigned int>(distanceFieldFont->getSolidRect().left), static_cast<unsigned int>(distanceFieldFont->getSolidRect().top)).a == 255);
+
+        // Adding many glyphs makes the atlas grow
+        sf::String text;
+        for (sf::Uint32 c = 33; c < 127; ++c)
+            text += c;
+        distanceFieldFont->loadGlyphs(text, false);
+        distanceFieldFont->loadGlyphs(text, true);
+        REQUIRE(distanceFieldFont->getGlyph('~', true).textureRect.width > 0);
+    }
+
+    SECTION("Enabling") {
+        tgui::Font tguiFont{font};
+        REQUIRE(!tguiFont.isDistanceFieldEnabled());
+        REQUIRE(tgui::DistanceFieldFont::get(font.get()) == nullptr);
+
+        tguiFont.enableDistanceField();
+        REQUIRE(tguiFont.isDistanceFieldEnabled());
+        REQUIRE(tgui::DistanceFieldFont::get(font.get()) != nullptr);
+        REQUIRE(tgui::DistanceFieldFont::get(font.get())->getReferenceSize() == 48);
+
+        if (tgui::DistanceFieldFont::getShader())
+        {
+            auto layout = tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0);
+            REQUIRE(layout->getDistanceFieldFont() == tgui::DistanceFieldFont::get(font.get()));
+        }
+
+        tguiFont.disableDistanceField();
+        REQUIRE(!tguiFont.isDistanceFieldEnabled());
+        REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0)->getDistanceFieldFont() == nullptr);
+    }
+
+    SECTION("Layout") {
+        auto distanceFieldFont = std::make_shared<tgui::DistanceFieldFont>(font);
+
+        tgui::TextLayout layout{"Hello world\nSecond line", distanceFieldFont, 20, sf::Text::Underlined, 0};
+        REQUIRE(layout.getDistanceFieldFont() == distanceFieldFont);
+        REQUIRE(layout.getLines().size() == 2);
+
+        // The same glyphs are used for every size, so the text scales linearly
+        tgui::TextLayout smallLayout{"Hello world", distanceFieldFont, 20, sf::Text::Regular, 0};
+        tgui::TextLayout largeLayout{"Hello world", distanceFieldFont, 60, sf::Text::Regular, 0};
+        REQUIRE(largeLayout.getWidth() == Approx(smallLayout.getWidth() * 3));
+        REQUIRE(largeLayout.getVertices().size() == smallLayout.getVertices().size());
+        REQUIRE(largeLayout.getVertices()[0].texCoords == smallLayout.getVertices()[0].texCoords);
+
+        tgui::TextLayout wrappedLayout{"Hello world", distanceFieldFont, 20, sf::Text::Regular, smallLayout.getWidth() * 0.75f};
+        REQUIRE(wrappedLayout.getLines().size() == 2);
+    }
+}
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/FontMetrics.hpp>
+#include <TGUI/Font.hpp>
+
+#include <cmath>
+
+TEST_CASE("[FontMetrics]") {
+    std::shared_ptr<sf::Font> font = tgui::Font{"resources/DroidSansArmenian.ttf"}.getFont();
+    REQUIRE(font != nullptr);
+
+    tgui::FontMetrics::clear();
+    tgui::FontMetrics& metrics = tgui::FontMetrics::get(font);
+    REQUIRE(&tgui::FontMetrics::get(font) == &metrics);
+
+    SECTION("Line spacing") {
+        for (unsigned int size : {1u, 12u, 30u, 100u, 2000u})
+        {
+            REQUIRE(metrics.getLineSpacing(size) == font->getLineSpacing(size));
+            REQUIRE(metrics.getLineSpacing(size) == font->getLineSpacing(size));
+        }
+    }
+
+    SECTION("Vertical correction") {
+        for (unsigned int size : {1u, 12u, 30u, 100u})
+        {
+            const sf::FloatRect bounds = font->getGlyph('g', size, false).bounds;
+            REQUIRE(metrics.getVerticalCorrection(size, false) == Approx(size + bounds.height + bounds.top - font->getLineSpacing(size)));
+            REQUIRE(metrics.getVerticalCorrection(size, false) == metrics.getVerticalCorrection(size, false));
+        }
+    }
+
+    SECTION("Best text size") {
+        REQUIRE(metrics.findBestTextSize(1, 0) == 1);
+
+        for (float height : {5.f, 17.3f, 20.f, 64.5f, 300.f})
+        {
+            // The line spacing of the best size is closer to the height than the line spacing of the sizes next to it
+            const unsigned int size = metrics.findBestTextSize(height, 0);
+            REQUIRE(size >= 1);
+            REQUIRE(std::abs(font->getLineSpacing(size) - height) <= std::abs(font->getLineSpacing(size + 1) - height));
+            if (size > 1)
+                REQUIRE(std::abs(font->getLineSpacing(size) - height) <= std::abs(font->getLineSpacing(size - 1) - height));
+
+            REQUIRE(font->getLineSpacing(metrics.findBestTextSize(height, -1)) <= height);
+            REQUIRE(font->getLineSpacing(metrics.findBestTextSize(height, 1)) >= height);
+        }
+    }
+}
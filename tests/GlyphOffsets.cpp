@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/GlyphOffsets.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[GlyphOffsets]") {
+    std::shared_ptr<sf::Font> font = tgui::Font{"resources/DroidSansArmenian.ttf"}.getFont();
+    REQUIRE(font != nullptr);
+
+    tgui::GlyphOffsets offsets;
+    REQUIRE(offsets.getCharacterCount() == 0);
+    REQUIRE(offsets.getWidth() == 0);
+    REQUIRE(offsets.findCaretPosition(50) == 0);
+
+    const sf::String str = "Some Text\twith AV kerning";
+    offsets.setText(str, *font, 20);
+    REQUIRE(offsets.getCharacterCount() == str.getSize());
+
+    SECTION("Same positions as sf::Text") {
+        sf::Text text{str, *font, 20};
+        for (std::size_t i = 0; i <= str.getSize(); ++i)
+            REQUIRE(offsets.getOffset(i) == Approx(text.findCharacterPos(i).x));
+
+        REQUIRE(offsets.getWidth() == Approx(text.findCharacterPos(str.getSize()).x));
+        REQUIRE(offsets.getOffset(str.getSize() + 5) == offsets.getWidth());
+    }
+
+    SECTION("Caret position") {
+        REQUIRE(offsets.findCaretPosition(-10) == 0);
+        REQUIRE(offsets.findCaretPosition(offsets.getWidth() + 10) == str.getSize());
+
+        for (std::size_t i = 0; i < str.getSize(); ++i)
+        {
+            const float left = offsets.getOffset(i);
+            const float right = offsets.getOffset(i + 1);
+            if (left == right)
+                continue;
+
+            REQUIRE(offsets.findCaretPosition(left + (right - left) * 0.25f) == i);
+            REQUIRE(offsets.findCaretPosition(left + (right - left) * 0.75f) == i + 1);
+        }
+    }
+
+    SECTION("Update") {
+        const sf::String newStr = "Some Text\twith VA kerning and more";
+
+        tgui::GlyphOffsets expected;
+        expected.setText(newStr, *font, 20);
+
+        offsets.update(newStr, 15, *font, 20);
+        REQUIRE(offsets.getCharacterCount() == newStr.getSize());
+        for (std::size_t i = 0; i <= newStr.getSize(); ++i)
+            REQUIRE(offsets.getOffset(i) == expected.getOffset(i));
+
+        offsets.update("Some", 4, *font, 20);
+        REQUIRE(offsets.getCharacterCount() == 4);
+        REQUIRE(offsets.getWidth() == expected.getOffset(4));
+    }
+
+    SECTION("Filled by widget") {
+        offsets.truncate(2);
+        REQUIRE(offsets.getCharacterCount() == 2);
+
+        offsets.addCharacter(100);
+        REQUIRE(offsets.getCharacterCount() == 3);
+        REQUIRE(offsets.getWidth() == 100);
+    }
+}
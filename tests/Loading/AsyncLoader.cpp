@@ -0,0 +1,142 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../Tests.hpp"
+#include <TGUI/Loading/AsyncLoader.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Gui.hpp>
+
+#include <fstream>
+
+TEST_CASE("[AsyncLoader]") {
+    tgui::DefaultThemeLoader::flushCache();
+    tgui::TextureManager::clearPreloadedImages();
+
+    tgui::AsyncLoader loader{2};
+    REQUIRE(loader.getThreadCount() == 2);
+
+    SECTION("preloadTheme") {
+        auto future = loader.preloadTheme("resources/Black.txt");
+        REQUIRE_NOTHROW(future.get());
+        REQUIRE(tgui::TextureManager::hasPreloadedImage("resources/Black.png"));
+
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+        tgui::EditBox::Ptr editBox;
+        REQUIRE_NOTHROW(editBox = theme->load("EditBox"));
+        REQUIRE(editBox != nullptr);
+
+        auto missingFuture = loader.preloadTheme("resources/nonexistent.txt");
+        REQUIRE_THROWS_AS(missingFuture.get(), tgui::Exception);
+    }
+
+    SECTION("parseWidgetFile") {
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        parent->add(std::make_shared<tgui::Picture>("resources/image.png"), "MyPicture");
+        parent->add(tgui::Button::create("Text"), "MyButton");
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileAsyncLoader1.txt"));
+        parent->removeAllWidgets();
+        tgui::TextureManager::clearPreloadedImages();
+
+        auto future = loader.parseWidgetFile("WidgetFileAsyncLoader1.txt");
+        std::shared_ptr<tgui::DataIO::Node> rootNode;
+        REQUIRE_NOTHROW(rootNode = future.get());
+        REQUIRE(rootNode != nullptr);
+        REQUIRE(tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+
+        REQUIRE_NOTHROW(tgui::WidgetLoader::load(parent, rootNode));
+        REQUIRE(parent->getWidgets().size() == 2);
+        REQUIRE(parent->get("MyPicture") != nullptr);
+        REQUIRE(parent->get<tgui::Button>("MyButton")->getText() == "Text");
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileAsyncLoader2.txt"));
+        REQUIRE(compareFiles("WidgetFileAsyncLoader1.txt", "WidgetFileAsyncLoader2.txt"));
+
+        auto missingFuture = loader.parseWidgetFile("nonexistent.txt");
+        REQUIRE_THROWS_AS(missingFuture.get(), tgui::Exception);
+    }
+
+    SECTION("preloadImage") {
+        REQUIRE_NOTHROW(loader.preloadImage("resources/image.png").get());
+        REQUIRE(tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+
+        // The texture takes the image, it is no longer stored separately
+        tgui::Texture texture;
+        REQUIRE_NOTHROW(texture.load("resources/image.png"));
+        REQUIRE(texture.getData()->image != nullptr);
+        REQUIRE(!tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+
+        // Other parts of the image reuse the image of the first texture
+        tgui::Texture partTexture;
+        REQUIRE_NOTHROW(partTexture.load("resources/image.png", {0, 0, 10, 10}));
+        REQUIRE(partTexture.getData()->image == texture.getData()->image);
+
+        REQUIRE_NOTHROW(loader.preloadImage("resources/image.png").get());
+        tgui::TextureManager::clearPreloadedImages();
+        REQUIRE(!tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+    }
+
+    SECTION("preloadImage without keeping images in memory") {
+        tgui::TextureManager::setKeepImagesInMemory(false);
+        REQUIRE_NOTHROW(loader.preloadImage("resources/image.png").get());
+
+        tgui::Texture texture;
+        REQUIRE_NOTHROW(texture.load("resources/image.png"));
+        REQUIRE(texture.getData()->image == nullptr);
+        REQUIRE(!tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+
+        tgui::TextureManager::setKeepImagesInMemory(true);
+    }
+
+    SECTION("same image requested multiple times") {
+        // Every future only becomes ready once the image exists, also when another thread was decoding it
+        std::vector<std::shared_future<void>> futures;
+        for (unsigned int i = 0; i < 8; ++i)
+            futures.push_back(loader.preloadImage("resources/image.png"));
+
+        for (auto& future : futures)
+        {
+            REQUIRE_NOTHROW(future.get());
+            REQUIRE(tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+        }
+
+        tgui::TextureManager::clearPreloadedImages();
+    }
+
+    SECTION("image cache") {
+        ImageCacheGuard guard;
+        const std::string cacheFilename = tgui::TextureManager::getImageCacheFilename("resources/image.png");
+        REQUIRE(cacheFilename != "");
+        std::remove(cacheFilename.c_str());
+        guard.removeOnExit(cacheFilename);
+
+        // The decoded image is written to the cache directory by the worker thread
+        REQUIRE_NOTHROW(loader.preloadImage("resources/image.png").get());
+        REQUIRE(tgui::TextureManager::hasPreloadedImage("resources/image.png"));
+        REQUIRE(std::ifstream{cacheFilename}.is_open());
+    }
+}
@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../catch.hpp"
+#include <TGUI/Loading/DataIO.hpp>
+
+TEST_CASE("[DataIO]") {
+    SECTION("emit") {
+        std::stringstream input{"Property: Value;\n"
+                                "Panel.Name {\n"
+                                "    Size: (100, 50);\n"
+                                "    Button {\n"
+                                "        Text: \"Ok\";\n"
+                                "    }\n"
+                                "    Renderer {\n"
+                                "    }\n"
+                                "}\n"
+                                "Label {\n"
+                                "}\n"};
+
+        std::stringstream output;
+        tgui::DataIO::emit(tgui::DataIO::parse(input), output);
+        REQUIRE(output.str() == "property: Value;\n"
+                                "\n"
+                                "Panel.Name {\n"
+                                "    size: (100, 50);\n"
+                                "\n"
+                                "    Button {\n"
+                                "        text: \"Ok\";\n"
+                                "    }\n"
+                                "\n"
+                                "    Renderer {\n"
+                                "    }\n"
+                                "}\n"
+                                "\n"
+                                "Label {\n"
+                                "}\n");
+    }
+
+    SECTION("emit large file") {
+        auto rootNode = std::make_shared<tgui::DataIO::Node>();
+        for (unsigned int i = 0; i < 5000; ++i)
+        {
+            auto node = std::make_shared<tgui::DataIO::Node>();
+            node->parent = rootNode.get();
+            node->name = "Line";
+            node->propertyValuePairs["Text"] = std::make_shared<tgui::DataIO::ValueNode>(node.get(), "\"Some text on line " + std::to_string(i) + "\"");
+            rootNode->children.push_back(node);
+        }
+
+        std::stringstream output;
+        tgui::DataIO::emit(rootNode, output);
+
+        auto parsedNode = tgui::DataIO::parse(output);
+        REQUIRE(parsedNode->children.size() == 5000);
+        REQUIRE(parsedNode->children[4999]->propertyValuePairs["text"]->value == "\"Some text on line 4999\"");
+    }
+}
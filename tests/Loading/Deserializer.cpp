@@ -88,6 +88,8 @@ TEST_CASE("[Deserializer]") {
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "0").getNumber() == 0);
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "1").getNumber() == 1);
         REQUIRE(tgui::Deserializer::deserialize(Type::Number, "2.25").getNumber() == 2.25);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "-1e3").getNumber() == -1000);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "0.33333334").getNumber() == 1.f / 3.f);
     }
 
     SECTION("deserialize borders") {
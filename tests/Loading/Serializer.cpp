@@ -92,6 +92,10 @@ TEST_CASE("[Serializer]") {
         REQUIRE(tgui::Serializer::serialize({0}) == "0");
         REQUIRE(tgui::Serializer::serialize({1}) == "1");
         REQUIRE(tgui::Serializer::serialize({2.15f}) == "2.15");
+        REQUIRE(tgui::Serializer::serialize({-0.5f}) == "-0.5");
+        REQUIRE(tgui::Serializer::serialize({1.f / 3.f}) == "0.33333334");
+        REQUIRE(tgui::Serializer::serialize({10000000.f}) == "10000000");
+        REQUIRE(tgui::Serializer::serialize({0.00001f}) == "0.00001");
     }
 
     SECTION("custom serialize function") {
@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/MemoryPool.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[MemoryPool]") {
+    SECTION("Allocate") {
+        const std::size_t usedBlocks = tgui::MemoryPool::getUsedBlockCount();
+
+        void* block1 = tgui::MemoryPool::allocate(24);
+        void* block2 = tgui::MemoryPool::allocate(24);
+        REQUIRE(block1 != block2);
+        REQUIRE(tgui::MemoryPool::getUsedBlockCount() == usedBlocks + 2);
+        REQUIRE(tgui::MemoryPool::getReservedMemory() > 0);
+
+        // A freed block is reused by the next allocation of the same size
+        tgui::MemoryPool::deallocate(block2, 24);
+        REQUIRE(tgui::MemoryPool::allocate(24) == block2);
+
+        tgui::MemoryPool::deallocate(block1, 24);
+        tgui::MemoryPool::deallocate(block2, 24);
+        REQUIRE(tgui::MemoryPool::getUsedBlockCount() == usedBlocks);
+    }
+
+    SECTION("Disabled") {
+        REQUIRE(!tgui::MemoryPool::isEnabled());
+
+        const std::size_t usedBlocks = tgui::MemoryPool::getUsedBlockCount();
+        auto button = tgui::Button::create("Text");
+        REQUIRE(tgui::MemoryPool::getUsedBlockCount() == usedBlocks);
+    }
+
+    SECTION("Widgets") {
+        const std::size_t usedBlocks = tgui::MemoryPool::getUsedBlockCount();
+
+        tgui::MemoryPool::setEnabled(true);
+        auto panel = tgui::Panel::create();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto button = tgui::Button::create("Button");
+            button->setPosition({"parent.width / 2", i * 10.f});
+            panel->add(button);
+        }
+
+        auto copy = panel->clone();
+        tgui::MemoryPool::setEnabled(false);
+
+        REQUIRE(tgui::MemoryPool::getUsedBlockCount() > usedBlocks + 200);
+        REQUIRE(std::static_pointer_cast<tgui::Panel>(copy)->getWidgets().size() == 100);
+
+        // The objects that were allocated from the pool are returned to it, even though the pool is now disabled
+        panel = nullptr;
+        copy = nullptr;
+        REQUIRE(tgui::MemoryPool::getUsedBlockCount() == usedBlocks);
+    }
+
+    SECTION("Allocator") {
+        tgui::MemoryPool::setEnabled(true);
+        tgui::PoolAllocator<int> pooled;
+        tgui::MemoryPool::setEnabled(false);
+        tgui::PoolAllocator<int> notPooled;
+
+        REQUIRE(pooled.isPooled());
+        REQUIRE(!notPooled.isPooled());
+        REQUIRE(pooled != notPooled);
+        REQUIRE(tgui::PoolAllocator<char>(pooled) == pooled);
+    }
+}
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+
+TEST_CASE("[Profiler]") {
+    sf::RenderTexture texture;
+    texture.create(200, 100);
+    tgui::Gui gui{texture};
+    auto button = tgui::Button::create("Button");
+    gui.add(button);
+
+    SECTION("Disabled") {
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+
+        gui.draw();
+        gui.draw();
+        REQUIRE(tgui::Profiler::getLastFrameStats().scopes.empty());
+    }
+
+    SECTION("Enabled") {
+        tgui::Profiler::setEnabled(true);
+        REQUIRE(tgui::Profiler::isEnabled());
+
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 10;
+        event.mouseMove.y = 10;
+        gui.handleEvent(event);
+        button->setPosition(10, 10);
+        gui.draw();
+
+        const auto stats = tgui::Profiler::getLastFrameStats();
+        if (tgui::Profiler::isAvailable())
+        {
+            REQUIRE(stats.scopes.count("Gui/handleEvent") == 1);
+            REQUIRE(stats.scopes.at("Gui/draw").calls == 1);
+            REQUIRE(stats.scopes.at("Draw/Button").calls == 1);
+            REQUIRE(stats.scopes.at("Gui/draw").time >= stats.scopes.at("Draw/Button").time);
+            REQUIRE(stats.signalEmissions > 0);
+        }
+        else
+            REQUIRE(stats.scopes.empty());
+
+        // The next frame starts without the statistics of the previous one
+        gui.draw();
+        if (tgui::Profiler::isAvailable())
+            REQUIRE(tgui::Profiler::getLastFrameStats().scopes.count("Gui/handleEvent") == 0);
+
+        tgui::Profiler::setEnabled(false);
+    }
+
+    SECTION("Trace") {
+        tgui::Profiler::setEnabled(true);
+        tgui::Profiler::startTrace();
+        gui.draw();
+        tgui::Profiler::stopTrace();
+        tgui::Profiler::setEnabled(false);
+
+        const std::string trace = tgui::Profiler::getTrace();
+        REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+        if (tgui::Profiler::isAvailable())
+        {
+            REQUIRE(trace.find("\"name\":\"draw\",\"cat\":\"Gui\",\"ph\":\"X\"") != std::string::npos);
+            REQUIRE(trace.find("\"name\":\"Frame\",\"ph\":\"C\"") != std::string::npos);
+        }
+
+        tgui::Profiler::saveTrace("ProfilerTrace.json");
+        REQUIRE_THROWS_AS(tgui::Profiler::saveTrace("NonExistentDirectory/ProfilerTrace.json"), tgui::Exception);
+    }
+}
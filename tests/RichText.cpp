@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/RichText.hpp>
+#include <TGUI/Widgets/devel/RichTextLabel.hpp>
+#include <TGUI/Gui.hpp>
+
+TEST_CASE("[RichText]") {
+    const std::map<sf::String, sf::Color> colors = {{"red", sf::Color::Red}, {"green", sf::Color::Green}};
+
+    SECTION("Runs") {
+        tgui::RichText text{"normal *bold* ~*both*~ #red red _line_", colors};
+        REQUIRE(text.getText() == "normal bold both red line");
+
+        const auto& runs = text.getRuns();
+        REQUIRE(runs.size() == 7);
+
+        REQUIRE(runs[0].first == 0);
+        REQUIRE(runs[0].length == 7);
+        REQUIRE(runs[0].style == sf::Text::Regular);
+        REQUIRE(runs[0].color == sf::Color::White);
+
+        REQUIRE(runs[1].first == 7);
+        REQUIRE(runs[1].length == 4);
+        REQUIRE(runs[1].style == sf::Text::Bold);
+
+        REQUIRE(runs[3].first == 12);
+        REQUIRE(runs[3].length == 4);
+        REQUIRE(runs[3].style == (sf::Text::Bold | sf::Text::Italic));
+
+        REQUIRE(runs[5].first == 17);
+        REQUIRE(runs[5].length == 4);
+        REQUIRE(runs[5].color == sf::Color::Red);
+
+        REQUIRE(runs[6].first == 21);
+        REQUIRE(runs[6].length == 4);
+        REQUIRE(runs[6].style == sf::Text::Underlined);
+        REQUIRE(runs[6].color == sf::Color::Red);
+    }
+
+    SECTION("Merged runs") {
+        // Toggling a style twice without text in between doesn't split the run
+        tgui::RichText text{"a**b", colors, sf::Color::Blue};
+        REQUIRE(text.getText() == "ab");
+        REQUIRE(text.getRuns().size() == 1);
+        REQUIRE(text.getRuns()[0].color == sf::Color::Blue);
+
+        REQUIRE(tgui::RichText{"", colors}.getRuns().empty());
+        REQUIRE(tgui::RichText{"**", colors}.getRuns().empty());
+    }
+
+    SECTION("Escaping") {
+        REQUIRE(tgui::RichText{"\\*a\\~b\\_c\\#d", colors}.getText() == "*a~b_c#d");
+        REQUIRE(tgui::RichText{"a\\b", colors}.getText() == "a\\b");
+        REQUIRE(tgui::RichText{"\\*a*", colors}.getRuns().size() == 1);
+    }
+
+    SECTION("Colors") {
+        REQUIRE(tgui::RichText::findColor("green", colors) == sf::Color::Green);
+        REQUIRE(tgui::RichText::findColor("102030", colors) == sf::Color(0x10, 0x20, 0x30));
+        REQUIRE(tgui::RichText::findColor("A0b0C0", colors) == sf::Color(0xA0, 0xB0, 0xC0));
+        REQUIRE(tgui::RichText::findColor("unknown", colors) == sf::Color::White);
+        REQUIRE(tgui::RichText::findColor("", colors) == sf::Color::White);
+
+        // A newline behind the color name isn't removed
+        tgui::RichText text{"#00ff00\nx", colors};
+        REQUIRE(text.getText() == "\nx");
+        REQUIRE(text.getRuns()[0].color == sf::Color::Green);
+    }
+
+    SECTION("Vertices") {
+        std::shared_ptr<sf::Font> font = tgui::Font{"resources/DroidSansArmenian.ttf"}.getFont();
+        REQUIRE(font != nullptr);
+
+        std::vector<sf::Vertex> vertices;
+        const sf::Vector2f size = tgui::RichText{"ab *cd*\n#red ef", colors}.createVertices(*font, 20, vertices);
+        REQUIRE(vertices.size() == 6 * 6);
+        REQUIRE(vertices[0].color == sf::Color::White);
+        REQUIRE(vertices.back().color == sf::Color::Red);
+        REQUIRE(size.x > 0);
+        REQUIRE(size.y > font->getLineSpacing(20));
+
+        // An underline adds one quad per line
+        vertices.clear();
+        tgui::RichText{"_ab\ncd_", colors}.createVertices(*font, 20, vertices);
+        REQUIRE(vertices.size() == 6 * 6);
+    }
+
+    SECTION("RichTextLabel") {
+        auto label = std::make_shared<tgui::RichTextLabel>();
+        label->setFont("resources/DroidSansArmenian.ttf");
+        label->setText("*Bold* #red text");
+        REQUIRE(label->getText() == "*Bold* #red text");
+        REQUIRE(label->getRichText().getText() == "Bold text");
+        REQUIRE(label->getRichText().getRuns().size() == 3);
+        REQUIRE(label->getSize().x > 0);
+        REQUIRE(label->getSize().y > 0);
+
+        SECTION("dirty area") {
+            sf::RenderTexture texture;
+            texture.create(400, 200);
+            tgui::Gui gui{texture};
+
+            label->setPosition(10, 20);
+            gui.add(label);
+            gui.draw();
+            REQUIRE(!gui.needsRedraw());
+
+            // Every change has to mark the area of the label as dirty, both where it was and where it is now
+            auto requireDirtyLabel = [&](const sf::FloatRect& previousArea){
+                const sf::FloatRect dirtyArea = gui.getDirtyArea();
+                const sf::FloatRect labelArea{label->getPosition(), label->getSize()};
+                for (const auto& area : {previousArea, labelArea})
+                {
+                    const float dirtyRight = dirtyArea.left + dirtyArea.width;
+                    const float dirtyBottom = dirtyArea.top + dirtyArea.height;
+                    REQUIRE(dirtyArea.left <= area.left);
+                    REQUIRE(dirtyArea.top <= area.top);
+                    REQUIRE(dirtyRight >= area.left + area.width);
+                    REQUIRE(dirtyBottom >= area.top + area.height);
+                }
+                gui.draw();
+                REQUIRE(!gui.needsRedraw());
+            };
+
+            sf::FloatRect previousArea{label->getPosition(), label->getSize()};
+            label->setText("Much longer *bold* text");
+            requireDirtyLabel(previousArea);
+
+            previousArea = {label->getPosition(), label->getSize()};
+            label->setText("Short");
+            requireDirtyLabel(previousArea);
+
+            previousArea = {label->getPosition(), label->getSize()};
+            label->setTextSize(15);
+            requireDirtyLabel(previousArea);
+
+            previousArea = {label->getPosition(), label->getSize()};
+            label->setBackgroundColor(sf::Color::Green);
+            requireDirtyLabel(previousArea);
+
+            previousArea = {label->getPosition(), label->getSize()};
+            label->setFont("resources/DroidSansArmenian.ttf");
+            requireDirtyLabel(previousArea);
+        }
+    }
+}
@@ -96,4 +96,26 @@ TEST_CASE("[Signal]") {
         widget->setSize(200, 50);
         REQUIRE(i == 2);
     }
+
+    SECTION("copy") {
+        unsigned int i = 0;
+        widget->connect("PositionChanged", [&](){ i++; });
+
+        auto copy = widget->clone();
+        copy->setPosition(10, 10);
+        REQUIRE(i == 1);
+
+        // Connecting to a signal of the copy does not affect the original widget
+        copy->connect("SizeChanged", [&](){ i += 10; });
+        widget->setSize(100, 25);
+        REQUIRE(i == 1);
+        copy->setSize(100, 25);
+        REQUIRE(i == 11);
+
+        widget->disconnectAll();
+        copy->setPosition(20, 20);
+        REQUIRE(i == 12);
+
+        REQUIRE_THROWS_AS(widget->disconnectAll("SomeWrongSignal"), tgui::Exception);
+    }
 }
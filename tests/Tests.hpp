@@ -26,5 +26,44 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/TextureManager.hpp>
+
+#include <cstdio>
+#include <vector>
 
 bool compareFiles(const std::string& leftFileName, const std::string& rightFileName);
+
+// Enables the image cache in the working directory for the lifetime of the guard. The image loader and the cache directory
+// are restored and the files that were passed to removeOnExit are deleted, also when a REQUIRE fails halfway through a test.
+struct ImageCacheGuard
+{
+    ImageCacheGuard() :
+        oldImageLoader(tgui::Texture::getImageLoader()),
+        oldCacheDirectory(tgui::TextureManager::getImageCacheDirectory())
+    {
+        tgui::TextureManager::setImageCacheDirectory(".");
+    }
+
+    ~ImageCacheGuard()
+    {
+        tgui::Texture::setImageLoader(oldImageLoader);
+        tgui::TextureManager::setImageCacheDirectory(oldCacheDirectory);
+        tgui::TextureManager::clearPreloadedImages();
+
+        for (auto& filename : filesToRemove)
+            std::remove(filename.c_str());
+    }
+
+    void removeOnExit(const std::string& filename)
+    {
+        if (!filename.empty())
+            filesToRemove.push_back(filename);
+    }
+
+    ImageCacheGuard(const ImageCacheGuard&) = delete;
+    ImageCacheGuard& operator=(const ImageCacheGuard&) = delete;
+
+    tgui::Texture::ImageLoaderFunc oldImageLoader;
+    std::string oldCacheDirectory;
+    std::vector<std::string> filesToRemove;
+};
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextLayout.hpp>
+#include <TGUI/Widgets/Label.hpp>
+
+TEST_CASE("[TextLayout]") {
+    std::shared_ptr<sf::Font> font = tgui::Font{"resources/DroidSansArmenian.ttf"}.getFont();
+    REQUIRE(font != nullptr);
+
+    SECTION("Lines") {
+        tgui::TextLayout layout{"Hello world\nSecond line", *font, 20, sf::Text::Regular, 0};
+        REQUIRE(layout.getLines().size() == 2);
+        REQUIRE(layout.getWidth() > 0);
+
+        // Spaces don't have vertices, all other characters have two triangles
+        REQUIRE(layout.getLines()[0].vertexCount == 10 * 6);
+        REQUIRE(layout.getLines()[1].firstVertex == 10 * 6);
+        REQUIRE(layout.getVertices().size() == 20 * 6);
+
+        REQUIRE(tgui::TextLayout("", *font, 20, sf::Text::Regular, 0).getLines().empty());
+    }
+
+    SECTION("Word wrap") {
+        tgui::TextLayout layout{"Hello world", *font, 20, sf::Text::Regular, 0};
+        const float width = layout.getLines()[0].width;
+
+        tgui::TextLayout wrappedLayout{"Hello world", *font, 20, sf::Text::Regular, width * 0.75f};
+        REQUIRE(wrappedLayout.getLines().size() == 2);
+        REQUIRE(wrappedLayout.getLines()[0].width < width);
+    }
+
+    SECTION("Cache") {
+        tgui::TextLayoutCache::clear();
+        REQUIRE(tgui::TextLayoutCache::getSize() == 0);
+
+        auto layout1 = tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0);
+        auto layout2 = tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0);
+        REQUIRE(layout1 == layout2);
+        REQUIRE(tgui::TextLayoutCache::getSize() == 1);
+
+        REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 22, sf::Text::Regular, 0) != layout1);
+        REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Bold, 0) != layout1);
+        REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 10) != layout1);
+        REQUIRE(tgui::TextLayoutCache::getLayout("Other", font, 20, sf::Text::Regular, 0) != layout1);
+        REQUIRE(tgui::TextLayoutCache::getSize() == 5);
+
+        SECTION("Least recently used layouts are removed") {
+            tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0);
+
+            const std::size_t oldCapacity = tgui::TextLayoutCache::getCapacity();
+            tgui::TextLayoutCache::setCapacity(1);
+            REQUIRE(tgui::TextLayoutCache::getSize() == 1);
+            REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0) == layout1);
+
+            tgui::TextLayoutCache::getLayout("Other", font, 20, sf::Text::Regular, 0);
+            REQUIRE(tgui::TextLayoutCache::getSize() == 1);
+            REQUIRE(tgui::TextLayoutCache::getLayout("Text", font, 20, sf::Text::Regular, 0) != layout1);
+
+            tgui::TextLayoutCache::setCapacity(oldCapacity);
+        }
+
+        SECTION("Labels share layouts") {
+            auto label1 = std::make_shared<tgui::Label>();
+            auto label2 = std::make_shared<tgui::Label>();
+            label1->setFont(tgui::Font{font});
+            label2->setFont(tgui::Font{font});
+
+            const std::size_t size = tgui::TextLayoutCache::getSize();
+            label1->setText("Shared label text");
+            REQUIRE(tgui::TextLayoutCache::getSize() == size + 1);
+            label2->setText("Shared label text");
+            REQUIRE(tgui::TextLayoutCache::getSize() == size + 1);
+            REQUIRE(label1->getSize() == label2->getSize());
+        }
+
+        tgui::TextLayoutCache::clear();
+    }
+}
@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextValidator.hpp>
+
+TEST_CASE("[TextValidator]") {
+    SECTION("Built-in validators") {
+        tgui::TextValidator validator{"[+-]?[0-9]*\\.?[0-9]*"};
+        REQUIRE(validator.getPattern() == "[+-]?[0-9]*\\.?[0-9]*");
+        REQUIRE(validator.matches(""));
+        REQUIRE(validator.matches("-6."));
+        REQUIRE(validator.matches(".001"));
+        REQUIRE(!validator.matches("1.5.2"));
+        REQUIRE(!validator.matches("5-"));
+
+        REQUIRE(tgui::TextValidator{".*"}.acceptsEverything());
+        REQUIRE(!validator.acceptsEverything());
+    }
+
+    SECTION("Syntax") {
+        tgui::TextValidator validator{"[a-zA-Z_][a-zA-Z0-9_]*"};
+        REQUIRE(validator.matches("_name1"));
+        REQUIRE(!validator.matches("1name"));
+
+        validator = tgui::TextValidator{"(ab|c)+d?"};
+        REQUIRE(validator.matches("abcab"));
+        REQUIRE(validator.matches("cd"));
+        REQUIRE(!validator.matches("d"));
+        REQUIRE(!validator.matches("abdd"));
+
+        validator = tgui::TextValidator{"\\d{2,3}"};
+        REQUIRE(!validator.matches("1"));
+        REQUIRE(validator.matches("12"));
+        REQUIRE(validator.matches("123"));
+        REQUIRE(!validator.matches("1234"));
+
+        validator = tgui::TextValidator{"[^0-9]*"};
+        REQUIRE(validator.matches("text"));
+        REQUIRE(!validator.matches("text1"));
+
+        validator = tgui::TextValidator{"^(?:colou?r)$"};
+        REQUIRE(validator.matches("color"));
+        REQUIRE(validator.matches("colour"));
+        REQUIRE(!validator.matches("colouur"));
+    }
+
+    SECTION("Unicode") {
+        tgui::TextValidator validator{"[a-zà-ÿ]+"};
+        REQUIRE(validator.matches(L"éèa"));
+        REQUIRE(!validator.matches(L"éè1"));
+
+        validator = tgui::TextValidator{"\\u03B1."};
+        REQUIRE(validator.matches(L"αβ"));
+        REQUIRE(!validator.matches(L"aβ"));
+    }
+
+    SECTION("Incremental") {
+        tgui::TextValidator validator{"[0-9]+(\\.[0-9]+)?"};
+
+        auto state = validator.getStartState();
+        REQUIRE(!validator.isAccepting(state));
+
+        state = validator.next(state, '1');
+        REQUIRE(validator.isAccepting(state));
+
+        state = validator.next(state, '.');
+        REQUIRE(state != tgui::TextValidator::Rejected);
+        REQUIRE(!validator.isAccepting(state));
+
+        state = validator.next(state, '5');
+        REQUIRE(validator.isAccepting(state));
+
+        // Once no text can match anymore the state becomes rejected immediately
+        state = validator.next(state, '.');
+        REQUIRE(state == tgui::TextValidator::Rejected);
+        REQUIRE(validator.next(state, '5') == tgui::TextValidator::Rejected);
+    }
+
+    SECTION("Invalid pattern") {
+        REQUIRE_THROWS_AS(tgui::TextValidator{"(a"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextValidator{"a)"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextValidator{"[a-"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextValidator{"*"}, tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextValidator{"a{3,1}"}, tgui::Exception);
+    }
+}
@@ -205,6 +205,22 @@ TEST_CASE("[Texture]") {
         REQUIRE(destructCount == 3);
     }
 
+    SECTION("Changing a copy") {
+        tgui::Texture texture{"resources/image.png", {}, {10, 0, 30, 50}};
+        texture.setSize({200, 100});
+
+        tgui::Texture textureCopy{texture};
+        textureCopy.setSize({20, 100});
+        textureCopy.setColor(sf::Color::Red);
+
+        REQUIRE(texture.getSize() == sf::Vector2f(200, 100));
+        REQUIRE(texture.getColor() == sf::Color::White);
+        REQUIRE(texture.getScalingType() == tgui::Texture::ScalingType::Horizontal);
+        REQUIRE(textureCopy.getSize() == sf::Vector2f(20, 100));
+        REQUIRE(textureCopy.getColor() == sf::Color::Red);
+        REQUIRE(textureCopy.getScalingType() == tgui::Texture::ScalingType::Normal);
+    }
+
     SECTION("Size") {
         tgui::Texture texture;
         REQUIRE(texture.getSize() == sf::Vector2f());
@@ -22,9 +22,20 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include "catch.hpp"
+#include "Tests.hpp"
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Texture.hpp>
+#include <fstream>
+
+namespace
+{
+    void copyFile(const std::string& source, const std::string& destination)
+    {
+        std::ifstream in{source, std::ios::binary};
+        std::ofstream out{destination, std::ios::binary};
+        out << in.rdbuf();
+    }
+}
 
 TEST_CASE("[TextureManager]") {
     std::streambuf *oldbuf = sf::err().rdbuf(0);
@@ -47,3 +58,94 @@ TEST_CASE("[TextureManager]") {
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(texture1.getData()));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(texture1.getData()), tgui::Exception);
 }
+
+TEST_CASE("[TextureManager] alpha mask") {
+    REQUIRE(tgui::TextureManager::getAlphaMaskScale() == 1);
+    REQUIRE(tgui::TextureManager::getKeepImagesInMemory());
+
+    SECTION("Full resolution") {
+        tgui::Texture texture{"resources/TransparentParts.png", {10, 10, 30, 30}};
+        REQUIRE(texture.getData()->image != nullptr);
+        REQUIRE(!texture.getData()->alphaMask.isEmpty());
+        REQUIRE(texture.getData()->alphaMask.size == sf::Vector2u(30, 30));
+
+        // The mask contains the same information as the image
+        for (unsigned int x = 0; x < 30; ++x)
+        {
+            for (unsigned int y = 0; y < 30; ++y)
+            {
+                const bool transparent = (texture.getData()->image->getPixel(x + 10, y + 10).a == 0);
+                REQUIRE(texture.getData()->alphaMask.isTransparentPixel(x, y) == transparent);
+            }
+        }
+    }
+
+    SECTION("Without image") {
+        tgui::TextureManager::setKeepImagesInMemory(false);
+        REQUIRE(!tgui::TextureManager::getKeepImagesInMemory());
+
+        tgui::Texture texture{"resources/TransparentParts.png", {10, 10, 30, 30}};
+        REQUIRE(texture.getData()->image == nullptr);
+
+        // Hit testing still works with only the mask
+        texture.setPosition({10, 20});
+        texture.setSize({60, 15});
+        REQUIRE(!texture.isTransparentPixel(21, 22.5f));
+        REQUIRE(texture.isTransparentPixel(22, 23));
+
+        tgui::TextureManager::setKeepImagesInMemory(true);
+    }
+
+    SECTION("Reduced resolution") {
+        tgui::TextureManager::setAlphaMaskScale(4);
+        REQUIRE(tgui::TextureManager::getAlphaMaskScale() == 4);
+
+        tgui::Texture texture{"resources/TransparentParts.png", {10, 10, 30, 30}};
+        REQUIRE(texture.getData()->alphaMask.size == sf::Vector2u(8, 8));
+
+        tgui::TextureManager::setAlphaMaskScale(0);
+        REQUIRE(tgui::TextureManager::getAlphaMaskScale() == 1);
+    }
+}
+
+TEST_CASE("[TextureManager] image cache") {
+    REQUIRE(tgui::TextureManager::getImageCacheDirectory() == "");
+    REQUIRE(tgui::TextureManager::getImageCacheFilename("resources/image.png") == "");
+
+    ImageCacheGuard guard;
+    REQUIRE(tgui::TextureManager::getImageCacheDirectory() == "./");
+
+    // The test changes the image, so it uses a copy of it
+    guard.removeOnExit("ImageCacheTest.png");
+    copyFile("resources/image.png", "ImageCacheTest.png");
+    guard.removeOnExit(tgui::TextureManager::getImageCacheFilename("ImageCacheTest.png"));
+
+    sf::Vector2f imageSize;
+    {
+        tgui::Texture texture{"ImageCacheTest.png"};
+        imageSize = texture.getImageSize();
+    }
+
+    // The image is taken from the cache without decoding it again
+    tgui::Texture::setImageLoader([](const sf::String&){ return std::shared_ptr<sf::Image>(); });
+    {
+        tgui::Texture texture;
+        REQUIRE_NOTHROW(texture.load("ImageCacheTest.png"));
+        REQUIRE(texture.getImageSize() == imageSize);
+        REQUIRE(texture.getData()->image != nullptr);
+    }
+
+    // The cached pixels are not used when the contents of the image file changed
+    copyFile("resources/Black.png", "ImageCacheTest.png");
+    guard.removeOnExit(tgui::TextureManager::getImageCacheFilename("ImageCacheTest.png"));
+    {
+        tgui::Texture texture;
+        REQUIRE_THROWS_AS(texture.load("ImageCacheTest.png"), tgui::Exception);
+    }
+
+    tgui::Texture::setImageLoader(guard.oldImageLoader);
+    {
+        tgui::Texture texture{"ImageCacheTest.png"};
+        REQUIRE(texture.getImageSize() != imageSize);
+    }
+}
@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Tween.hpp>
+#include <TGUI/Widgets/Button.hpp>
+
+TEST_CASE("[Tween]") {
+    tgui::Button::Ptr button = std::make_shared<tgui::Button>();
+    tgui::Tweener tweener;
+
+    SECTION("Easing") {
+        for (auto easing : {tgui::Easing::Linear, tgui::Easing::QuadraticIn, tgui::Easing::QuadraticOut, tgui::Easing::QuadraticInOut,
+                            tgui::Easing::CubicIn, tgui::Easing::CubicOut, tgui::Easing::CubicInOut, tgui::Easing::SineIn,
+                            tgui::Easing::SineOut, tgui::Easing::SineInOut, tgui::Easing::BackOut, tgui::Easing::BounceOut})
+        {
+            REQUIRE(tgui::applyEasing(easing, 0) == Approx(0));
+            REQUIRE(tgui::applyEasing(easing, 1) == Approx(1));
+        }
+
+        REQUIRE(tgui::applyEasing(tgui::Easing::Linear, 0.25f) == Approx(0.25f));
+        REQUIRE(tgui::applyEasing(tgui::Easing::QuadraticIn, 0.5f) == Approx(0.25f));
+        REQUIRE(tgui::applyEasing(tgui::Easing::QuadraticOut, 0.5f) == Approx(0.75f));
+        REQUIRE(tgui::applyEasing(tgui::Easing::BackOut, 0.8f) > 1);
+    }
+
+    SECTION("Number") {
+        float value = 0;
+        tweener.add(button, {10, 20, sf::milliseconds(200), [&](float v){ value = v; }});
+        REQUIRE(tweener.getTweenCount() == 1);
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(value == Approx(12.5f));
+
+        tweener.update(sf::milliseconds(200));
+        REQUIRE(value == 20);
+        REQUIRE(tweener.getTweenCount() == 0);
+    }
+
+    SECTION("Color") {
+        tgui::Color color = sf::Color::Black;
+        tweener.add(button, {sf::Color{0, 0, 0, 255}, sf::Color{200, 100, 50, 55}, sf::milliseconds(100), [&](const tgui::Color& c){ color = c; }});
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(sf::Color(color) == sf::Color(100, 50, 25, 155));
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(sf::Color(color) == sf::Color(200, 100, 50, 55));
+    }
+
+    SECTION("Borders") {
+        auto renderer = button->getRenderer();
+        tweener.add(button, {tgui::Borders{0, 0, 0, 0}, tgui::Borders{2, 4, 6, 8}, sf::milliseconds(100),
+                             [renderer](const tgui::Borders& borders){ renderer->setBorders(borders); }});
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(renderer->getBorders().left == Approx(1));
+        REQUIRE(renderer->getBorders().top == Approx(2));
+        REQUIRE(renderer->getBorders().right == Approx(3));
+        REQUIRE(renderer->getBorders().bottom == Approx(4));
+    }
+
+    SECTION("Delay") {
+        float value = 0;
+        tweener.add(button, {0, 1, sf::milliseconds(100), [&](float v){ value = v; }}, sf::milliseconds(100));
+
+        tweener.update(sf::milliseconds(60));
+        REQUIRE(value == 0);
+
+        tweener.update(sf::milliseconds(90));
+        REQUIRE(value == Approx(0.5f));
+    }
+
+    SECTION("Timeline") {
+        float first = 0;
+        float second = 0;
+        float third = 0;
+
+        tgui::Timeline timeline;
+        timeline.then({0, 1, sf::milliseconds(100), [&](float v){ first = v; }})
+                .with({0, 1, sf::milliseconds(200), [&](float v){ second = v; }})
+                .wait(sf::milliseconds(100))
+                .then({0, 1, sf::milliseconds(100), [&](float v){ third = v; }});
+        REQUIRE(timeline.getDuration() == sf::milliseconds(400));
+
+        tweener.add(button, timeline);
+        REQUIRE(tweener.getTweenCount() == 3);
+
+        tweener.update(sf::milliseconds(100));
+        REQUIRE(first == 1);
+        REQUIRE(second == Approx(0.5f));
+        REQUIRE(third == 0);
+
+        tweener.update(sf::milliseconds(250));
+        REQUIRE(second == 1);
+        REQUIRE(third == Approx(0.5f));
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(third == 1);
+        REQUIRE(tweener.getTweenCount() == 0);
+    }
+
+    SECTION("Stop") {
+        float value = 0;
+        tweener.add(button, {0, 1, sf::milliseconds(100), [&](float v){ value = v; }});
+        tweener.update(sf::milliseconds(50));
+
+        SECTION("Keep current value") {
+            tweener.stop(button);
+            REQUIRE(value == Approx(0.5f));
+        }
+
+        SECTION("Finish") {
+            tweener.stop(button, true);
+            REQUIRE(value == 1);
+        }
+
+        REQUIRE(tweener.getTweenCount() == 0);
+    }
+
+    SECTION("Tween stops when widget is destroyed") {
+        float value = 0;
+        tweener.add(button, {0, 1, sf::milliseconds(100), [&](float v){ value = v; }});
+        button = nullptr;
+
+        tweener.update(sf::milliseconds(50));
+        REQUIRE(value == 0);
+        REQUIRE(tweener.getTweenCount() == 0);
+    }
+}
@@ -38,6 +38,56 @@ TEST_CASE("[Canvas]") {
         REQUIRE(canvas->getSize() == sf::Vector2f(200, 100));
     }
 
+    SECTION("KeepContentsOnResize") {
+        REQUIRE(!canvas->getKeepContentsOnResize());
+        canvas->setKeepContentsOnResize(true);
+        REQUIRE(canvas->getKeepContentsOnResize());
+        canvas->setKeepContentsOnResize(false);
+        REQUIRE(!canvas->getKeepContentsOnResize());
+    }
+
+    SECTION("Resizing") {
+        struct TestCanvas : public tgui::Canvas
+        {
+            sf::Color getPixel(unsigned int x, unsigned int y) const
+            {
+                return m_renderTexture.getTexture().copyToImage().getPixel(x, y);
+            }
+
+            sf::IntRect getTextureRect() const
+            {
+                return m_sprite.getTextureRect();
+            }
+        };
+
+        TestCanvas testCanvas;
+        testCanvas.setSize(50, 40);
+        REQUIRE(testCanvas.getTextureRect() == sf::IntRect(0, 0, 50, 40));
+
+        testCanvas.clear(sf::Color::Red);
+        testCanvas.display();
+
+        // Shrinking reuses the texture but clears it by default
+        testCanvas.setSize(30, 20);
+        REQUIRE(testCanvas.getTextureRect() == sf::IntRect(0, 0, 30, 20));
+        REQUIRE(testCanvas.getPixel(10, 10) == sf::Color::Black);
+
+        testCanvas.setKeepContentsOnResize(true);
+        testCanvas.clear(sf::Color::Green);
+        testCanvas.display();
+
+        testCanvas.setSize(40, 30);
+        REQUIRE(testCanvas.getTextureRect() == sf::IntRect(0, 0, 40, 30));
+        REQUIRE(testCanvas.getPixel(10, 10) == sf::Color::Green);
+
+        // Growing beyond the texture size creates a new texture with the old contents in it
+        testCanvas.setSize(200, 100);
+        REQUIRE(testCanvas.getSize() == sf::Vector2f(200, 100));
+        REQUIRE(testCanvas.getTextureRect() == sf::IntRect(0, 0, 200, 100));
+        REQUIRE(testCanvas.getPixel(10, 10) == sf::Color::Green);
+        REQUIRE(testCanvas.getPixel(150, 80) == sf::Color::Black);
+    }
+
     SECTION("Saving and loading from file") {
         REQUIRE_NOTHROW(canvas = std::make_shared<tgui::Canvas>(60.f, 40.f));
 
@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/devel/DataGrid.hpp>
+#include <TGUI/Gui.hpp>
+
+TEST_CASE("[DataGrid]") {
+    tgui::DataGrid::Ptr grid = std::make_shared<tgui::DataGrid>();
+    grid->setHeaderColumns({"Name", "Age"});
+    grid->addRow({"Charlie", "30"});
+    grid->addRow({"Alice", "25"});
+    grid->addRow({"Bob", "35"});
+
+    SECTION("Signals") {
+        REQUIRE_NOTHROW(grid->connect("RowSelected", [](){}));
+        REQUIRE_NOTHROW(grid->connect("RowSelected", [](int){}));
+    }
+
+    SECTION("WidgetType") {
+        REQUIRE(grid->getWidgetType() == "DataGrid");
+    }
+
+    SECTION("Items") {
+        REQUIRE(grid->getColumnCount() == 2);
+        REQUIRE(grid->getRowCount() == 3);
+        REQUIRE(grid->getItem(1, 0) == "Alice");
+        REQUIRE(grid->getItem(2, 1) == "35");
+
+        REQUIRE(grid->changeItem(1, 1, "26"));
+        REQUIRE(grid->getItem(1, 1) == "26");
+        REQUIRE(!grid->changeItem(3, 0, "Dave"));
+
+        // Rows with more columns add a column to the other rows
+        grid->addRow({"Dave", "40", "Extra"});
+        REQUIRE(grid->getColumnCount() == 3);
+        REQUIRE(grid->getItem(0, 2) == "");
+        REQUIRE(grid->getItem(3, 2) == "Extra");
+
+        grid->removeAllRows();
+        REQUIRE(grid->getRowCount() == 0);
+        REQUIRE(grid->getShownRows().empty());
+    }
+
+    SECTION("Sorting") {
+        grid->sortByColumn(0);
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({1, 2, 0}));
+        REQUIRE(grid->getItem(1, 0) == "Alice");
+
+        grid->sortByColumn(1, false);
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({2, 0, 1}));
+
+        grid->sort([](std::size_t left, std::size_t right){ return left < right; });
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({0, 1, 2}));
+    }
+
+    SECTION("Filtering") {
+        grid->setFilter([&](std::size_t row){ return grid->getItem(row, 0) != "Alice"; });
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({0, 2}));
+
+        grid->sortByColumn(0);
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({2, 0}));
+
+        grid->addRow({"Aaron", "20"});
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({2, 0, 3}));
+
+        grid->removeFilter();
+        REQUIRE(grid->getShownRows() == std::vector<std::size_t>({1, 2, 0, 3}));
+    }
+
+    SECTION("Row at height") {
+        const float rowHeight = grid->getRowHeight(0);
+        REQUIRE(grid->getRowAtHeight(-1) == -1);
+        REQUIRE(grid->getRowAtHeight(0) == 0);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 1.5f) == 1);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 3) == -1);
+
+        grid->sortByColumn(0);
+        REQUIRE(grid->getRowAtHeight(0) == 1);
+
+        // Rows with a different height
+        grid->setRowHeight(1, rowHeight * 3);
+        REQUIRE(grid->getRowHeight(1) == rowHeight * 3);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 2.5f) == 1);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 3.5f) == 2);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 4.5f) == 0);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 5) == -1);
+
+        grid->setRowHeight(1, 0);
+        REQUIRE(grid->getRowHeight(1) == rowHeight);
+        REQUIRE(grid->getRowAtHeight(rowHeight * 1.5f) == 2);
+    }
+
+    SECTION("Selection") {
+        unsigned int count = 0;
+        grid->connect("RowSelected", [&](int){ ++count; });
+
+        REQUIRE(grid->getSelectedRow() == -1);
+        grid->setSelectedRow(2);
+        REQUIRE(grid->getSelectedRow() == 2);
+        REQUIRE(count == 1);
+
+        grid->setSelectedRow(5);
+        REQUIRE(grid->getSelectedRow() == -1);
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Hovered row") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        grid->setPosition(0, 0);
+        grid->setSize(200, 200);
+        grid->setRowsColor(sf::Color::White);
+        grid->setHoveringRowColor(sf::Color::Green);
+        gui.add(grid);
+
+        auto moveMouse = [&](int x, int y){
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            gui.handleEvent(event);
+        };
+
+        auto drawAndGetPixel = [&](unsigned int x, unsigned int y){
+            target.clear();
+            gui.draw();
+            target.display();
+            return target.getTexture().copyToImage().getPixel(x, y);
+        };
+
+        const float rowTop = grid->getRowHeight(0) + 1;
+        const unsigned int secondRowY = static_cast<unsigned int>(rowTop + grid->getRowHeight(0) * 1.5f);
+        const unsigned int firstRowY = static_cast<unsigned int>(rowTop + grid->getRowHeight(0) * 0.5f);
+        REQUIRE(drawAndGetPixel(50, secondRowY) == sf::Color::White);
+
+        moveMouse(50, secondRowY);
+        REQUIRE(drawAndGetPixel(50, secondRowY) == sf::Color::Green);
+        REQUIRE(drawAndGetPixel(50, firstRowY) == sf::Color::White);
+
+        // The selected color takes priority over the hover color
+        grid->setSelectedRowColor(sf::Color::Blue);
+        grid->setSelectedRow(1);
+        REQUIRE(drawAndGetPixel(50, secondRowY) == sf::Color::Blue);
+        grid->setSelectedRow(-1);
+
+        moveMouse(300, 300);
+        REQUIRE(drawAndGetPixel(50, secondRowY) == sf::Color::White);
+    }
+}
@@ -101,6 +101,104 @@ TEST_CASE("[EditBox]") {
         REQUIRE(editBox->isTextWidthLimited());
         editBox->limitTextWidth(false);
         REQUIRE(!editBox->isTextWidthLimited());
+
+        SECTION("Typing") {
+            editBox->setSize(100, 30);
+            editBox->setTextSize(20);
+            editBox->limitTextWidth(true);
+
+            for (unsigned int i = 0; i < 100; ++i)
+                editBox->textEntered('W');
+
+            const std::size_t length = editBox->getText().getSize();
+            REQUIRE(length > 0);
+            REQUIRE(length < 100);
+
+            editBox->setCaretPosition(0);
+            editBox->textEntered('W');
+            REQUIRE(editBox->getText().getSize() == length);
+
+            sf::Event::KeyEvent event;
+            event.control = false;
+            event.alt     = false;
+            event.shift   = false;
+            event.system  = false;
+            event.code    = sf::Keyboard::Delete;
+            editBox->keyPressed(event);
+            REQUIRE(editBox->getText().getSize() == length - 1);
+
+            editBox->textEntered('W');
+            REQUIRE(editBox->getText().getSize() == length);
+        }
+    }
+
+    SECTION("Selection colors") {
+        // Gives access to the vertices of the text and allows selecting an arbitrary range
+        struct EditBoxVertices : public tgui::EditBox
+        {
+            sf::Color getCharacterColor(std::size_t index) const
+            {
+                REQUIRE(m_characterVertices[index] < m_characterVertices[index + 1]);
+                return m_textVertices[m_characterVertices[index]].color;
+            }
+
+            void select(std::size_t start, std::size_t end)
+            {
+                m_selStart = start;
+                m_selEnd = end;
+                m_selChars = (start < end) ? (end - start) : (start - end);
+                recalculateTextPositions();
+            }
+        };
+
+        auto box = std::make_shared<EditBoxVertices>();
+        box->setFont("resources/DroidSansArmenian.ttf");
+        box->getRenderer()->setTextColor(sf::Color::Red);
+        box->getRenderer()->setSelectedTextColor(sf::Color::Blue);
+        box->setText("abcdefgh");
+
+        // Returns the characters that have the selected color, e.g. "--XX----"
+        auto getSelectedCharacters = [&]{
+            std::string selected;
+            for (std::size_t i = 0; i < box->getText().getSize(); ++i)
+            {
+                const sf::Color color = box->getCharacterColor(i);
+                REQUIRE(((color == sf::Color::Red) || (color == sf::Color::Blue)));
+                selected += (color == sf::Color::Blue) ? 'X' : '-';
+            }
+            return selected;
+        };
+
+        REQUIRE(getSelectedCharacters() == "--------");
+
+        box->select(2, 4);
+        REQUIRE(getSelectedCharacters() == "--XX----");
+
+        box->select(2, 6);
+        REQUIRE(getSelectedCharacters() == "--XXXX--");
+
+        box->select(5, 1);
+        REQUIRE(getSelectedCharacters() == "-XXXX---");
+
+        box->select(6, 8);
+        REQUIRE(getSelectedCharacters() == "------XX");
+
+        box->selectText();
+        REQUIRE(getSelectedCharacters() == "XXXXXXXX");
+
+        box->getRenderer()->setSelectedTextColor(sf::Color::Green);
+        REQUIRE(box->getCharacterColor(3) == sf::Color::Green);
+        box->getRenderer()->setSelectedTextColor(sf::Color::Blue);
+
+        // Typing replaces the selection, the new character isn't selected
+        box->select(3, 6);
+        box->textEntered('x');
+        REQUIRE(box->getText() == "abcxgh");
+        REQUIRE(getSelectedCharacters() == "------");
+
+        box->select(0, 2);
+        box->setCaretPosition(4);
+        REQUIRE(getSelectedCharacters() == "------");
     }
 
     SECTION("CaretWidth") {
@@ -257,6 +355,29 @@ TEST_CASE("[EditBox]") {
                 REQUIRE(editBox->getText() == "-.");
             }
         }
+
+        SECTION("Custom") {
+            editBox->setInputValidator("[a-zà-ÿ]+[0-9]?");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText(L"éèa");
+            REQUIRE(editBox->getText() == L"éèa");
+
+            SECTION("Adding characters") {
+                editBox->textEntered('1');
+                REQUIRE(editBox->getText() == L"éèa1");
+
+                editBox->textEntered('2');
+                REQUIRE(editBox->getText() == L"éèa1");
+
+                editBox->setCaretPosition(1);
+                editBox->textEntered(L'ê');
+                REQUIRE(editBox->getText() == L"éêèa1");
+
+                editBox->textEntered('3');
+                REQUIRE(editBox->getText() == L"éêèa1");
+            }
+        }
     }
 
     SECTION("Renderer") {
@@ -96,6 +96,45 @@ TEST_CASE("[Label]") {
         REQUIRE(label->getMaximumTextWidth() == 300);
     }
 
+    SECTION("Drawing multiple lines") {
+        sf::RenderTexture target;
+        target.create(200, 200);
+
+        label->setTextSize(30);
+        label->setText("Line\nLine");
+        label->setTextColor(sf::Color::White);
+        label->getRenderer()->setBackgroundColor(sf::Color::Transparent);
+
+        // Returns whether some text was drawn between the given heights
+        auto containsText = [&](unsigned int top, unsigned int bottom){
+            target.clear();
+            target.draw(*label);
+            target.display();
+
+            const sf::Image image = target.getTexture().copyToImage();
+            for (unsigned int y = top; y < bottom; ++y)
+            {
+                for (unsigned int x = 0; x < image.getSize().x; ++x)
+                {
+                    if (image.getPixel(x, y) != sf::Color::Black)
+                        return true;
+                }
+            }
+            return false;
+        };
+
+        const unsigned int lineHeight = static_cast<unsigned int>(label->getSize().y / 2);
+        REQUIRE(containsText(0, lineHeight));
+        REQUIRE(containsText(lineHeight, 2 * lineHeight));
+        REQUIRE(!containsText(2 * lineHeight, 200));
+
+        // Both lines move together with the label
+        label->setPosition(0, 2 * lineHeight);
+        REQUIRE(!containsText(0, 2 * lineHeight));
+        REQUIRE(containsText(2 * lineHeight, 3 * lineHeight));
+        REQUIRE(containsText(3 * lineHeight, 4 * lineHeight));
+    }
+
     SECTION("Renderer") {
         auto renderer = label->getRenderer();
 
@@ -25,6 +25,7 @@
 #include "../Tests.hpp"
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Gui.hpp>
 
 TEST_CASE("[Panel]") {
     tgui::Panel::Ptr panel = std::make_shared<tgui::Panel>();
@@ -49,6 +50,59 @@ TEST_CASE("[Panel]") {
         REQUIRE(panel->getBackgroundColor() == sf::Color(10, 20, 30));
     }
 
+    SECTION("RenderCache") {
+        REQUIRE(!panel->isRenderCacheEnabled());
+        panel->setRenderCacheEnabled(true);
+        REQUIRE(panel->isRenderCacheEnabled());
+
+        auto copy = tgui::Panel::copy(panel);
+        REQUIRE(copy->isRenderCacheEnabled());
+
+        panel->setRenderCacheEnabled(false);
+        REQUIRE(!panel->isRenderCacheEnabled());
+    }
+
+    SECTION("RenderCache is rebuilt after changes") {
+        sf::RenderTexture target;
+        target.create(100, 100);
+        tgui::Gui gui{target};
+
+        panel->setPosition(0, 0);
+        panel->setSize(100, 100);
+        panel->setBackgroundColor(sf::Color::Black);
+        panel->setRenderCacheEnabled(true);
+        gui.add(panel);
+
+        auto child = std::make_shared<tgui::Panel>();
+        child->setPosition(10, 10);
+        child->setSize(40, 40);
+        child->setBackgroundColor(sf::Color::Green);
+        child->getRenderer()->setBorders({5, 5, 5, 5});
+        child->getRenderer()->setBorderColor(sf::Color::Red);
+        panel->add(child);
+
+        auto drawAndGetPixel = [&](unsigned int x, unsigned int y){
+            target.clear();
+            gui.draw();
+            target.display();
+            return target.getTexture().copyToImage().getPixel(x, y);
+        };
+
+        REQUIRE(drawAndGetPixel(7, 20) == sf::Color::Red);
+        REQUIRE(drawAndGetPixel(20, 20) == sf::Color::Green);
+
+        // Changing a renderer property of a child widget invalidates the cache
+        child->getRenderer()->setBorderColor(sf::Color::Blue);
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(drawAndGetPixel(7, 20) == sf::Color::Blue);
+
+        // Changing the child widget itself invalidates the cache
+        child->setPosition(50, 50);
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(drawAndGetPixel(20, 20) == sf::Color::Black);
+        REQUIRE(drawAndGetPixel(60, 60) == sf::Color::Green);
+    }
+
     SECTION("Renderer") {
         auto renderer = panel->getRenderer();
 
@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+TEST_CASE("[ScrollablePanel]") {
+    tgui::ScrollablePanel::Ptr panel = std::make_shared<tgui::ScrollablePanel>();
+    panel->setFont("resources/DroidSansArmenian.ttf");
+    panel->setSize(100, 100);
+
+    SECTION("WidgetType") {
+        REQUIRE(panel->getWidgetType() == "ScrollablePanel");
+    }
+
+    SECTION("ContentHeight") {
+        REQUIRE(panel->getContentHeight() == 0);
+        REQUIRE(panel->getScrollbar()->getMaximum() <= panel->getScrollbar()->getLowValue());
+
+        auto widget = std::make_shared<tgui::ClickableWidget>(50.f, 50.f);
+        widget->setPosition(0, 150);
+        panel->add(widget);
+        REQUIRE(panel->getScrollbar()->getMaximum() == 200);
+
+        widget->setPosition(0, 250);
+        REQUIRE(panel->getScrollbar()->getMaximum() == 300);
+
+        panel->setContentHeight(500);
+        REQUIRE(panel->getContentHeight() == 500);
+        REQUIRE(panel->getScrollbar()->getMaximum() == 500);
+
+        panel->setContentHeight(0);
+        panel->remove(widget);
+        REQUIRE(panel->getScrollbar()->getMaximum() <= panel->getScrollbar()->getLowValue());
+    }
+
+    SECTION("ScrollOffset") {
+        panel->setContentHeight(300);
+        REQUIRE(panel->getScrollOffset() == 0);
+
+        panel->setScrollOffset(120);
+        REQUIRE(panel->getScrollOffset() == 120);
+        REQUIRE(panel->getScrollbar()->getValue() == 120);
+
+        // The panel can't be scrolled beyond the bottom of the contents
+        panel->setScrollOffset(1000);
+        REQUIRE(panel->getScrollOffset() == 200);
+
+        panel->setScrollOffset(-10);
+        REQUIRE(panel->getScrollOffset() == 0);
+
+        panel->setScrollOffset(200);
+        panel->setContentHeight(150);
+        REQUIRE(panel->getScrollOffset() == 50);
+
+        panel->setScrollbar(nullptr);
+        REQUIRE(panel->getScrollbar() == nullptr);
+        panel->setScrollOffset(30);
+        REQUIRE(panel->getScrollOffset() == 30);
+    }
+
+    SECTION("Scrolling does not move the child widgets") {
+        auto widget = std::make_shared<tgui::ClickableWidget>(50.f, 50.f);
+        widget->setPosition(10, 150);
+        panel->add(widget);
+
+        unsigned int positionChangedCount = 0;
+        widget->connect("PositionChanged", [&](){ positionChangedCount++; });
+
+        panel->setScrollOffset(120);
+        REQUIRE(widget->getPosition() == sf::Vector2f(10, 150));
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(10, 30));
+        REQUIRE(positionChangedCount == 0);
+    }
+
+    SECTION("Mouse events") {
+        auto widget = std::make_shared<tgui::ClickableWidget>(50.f, 50.f);
+        widget->setPosition(0, 150);
+        panel->add(widget);
+
+        unsigned int mousePressedCount = 0;
+        sf::Vector2f mousePressedPos;
+        widget->connect("MousePressed", [&](sf::Vector2f pos){ mousePressedCount++; mousePressedPos = pos; });
+
+        // The widget lies below the visible area
+        panel->leftMousePressed(10, 40);
+        panel->leftMouseReleased(10, 40);
+        panel->mouseNoLongerDown();
+        REQUIRE(mousePressedCount == 0);
+
+        panel->setScrollOffset(120);
+        panel->leftMousePressed(10, 40);
+        panel->leftMouseReleased(10, 40);
+        panel->mouseNoLongerDown();
+        REQUIRE(mousePressedCount == 1);
+        REQUIRE(mousePressedPos == sf::Vector2f(10, 10));
+
+        // Scrolling with the mouse wheel
+        panel->mouseWheelMoved(1, 10, 40);
+        REQUIRE(panel->getScrollOffset() == 100);
+        panel->mouseWheelMoved(-10, 10, 40);
+        REQUIRE(panel->getScrollOffset() == 100);
+        panel->mouseWheelMoved(10, 10, 40);
+        REQUIRE(panel->getScrollOffset() == 0);
+    }
+
+    SECTION("Saving and loading from file") {
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        parent->add(panel);
+
+        auto widget = std::make_shared<tgui::ClickableWidget>(50.f, 50.f);
+        widget->setPosition(40, 150);
+        panel->add(widget);
+
+        panel->setContentHeight(400);
+        panel->setScrollOffset(60);
+        panel->setOpacity(0.8f);
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileScrollablePanel1.txt"));
+
+        parent->removeAllWidgets();
+        REQUIRE_NOTHROW(parent->loadWidgetsFromFile("WidgetFileScrollablePanel1.txt"));
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileScrollablePanel2.txt"));
+        REQUIRE(compareFiles("WidgetFileScrollablePanel1.txt", "WidgetFileScrollablePanel2.txt"));
+
+        SECTION("Copying widget") {
+            tgui::ScrollablePanel temp;
+            temp = *panel;
+
+            parent->removeAllWidgets();
+            parent->add(tgui::ScrollablePanel::copy(std::make_shared<tgui::ScrollablePanel>(temp)));
+
+            REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileScrollablePanel2.txt"));
+            REQUIRE(compareFiles("WidgetFileScrollablePanel1.txt", "WidgetFileScrollablePanel2.txt"));
+        }
+    }
+}
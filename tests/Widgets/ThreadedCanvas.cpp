@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../Tests.hpp"
+#include <TGUI/Widgets/ThreadedCanvas.hpp>
+
+#include <atomic>
+
+TEST_CASE("[ThreadedCanvas]") {
+    tgui::ThreadedCanvas::Ptr canvas = std::make_shared<tgui::ThreadedCanvas>();
+    canvas->setFont("resources/DroidSansArmenian.ttf");
+
+    SECTION("WidgetType") {
+        REQUIRE(canvas->getWidgetType() == "ThreadedCanvas");
+    }
+
+    SECTION("constructor") {
+        canvas = std::make_shared<tgui::ThreadedCanvas>(tgui::Layout2d{200.f, 100.f}, 2);
+        REQUIRE(canvas->getSize() == sf::Vector2f(200, 100));
+        REQUIRE(canvas->getBufferCount() == 2);
+
+        REQUIRE(std::make_shared<tgui::ThreadedCanvas>()->getBufferCount() == 3);
+        REQUIRE_THROWS_AS(std::make_shared<tgui::ThreadedCanvas>(tgui::Layout2d{200.f, 100.f}, 1), tgui::Exception);
+        REQUIRE_THROWS_AS(std::make_shared<tgui::ThreadedCanvas>(tgui::Layout2d{200.f, 100.f}, 4), tgui::Exception);
+    }
+
+    SECTION("FrameRateLimit") {
+        REQUIRE(canvas->getFrameRateLimit() == 60);
+        canvas->setFrameRateLimit(0);
+        REQUIRE(canvas->getFrameRateLimit() == 0);
+        canvas->setFrameRateLimit(30);
+        REQUIRE(canvas->getFrameRateLimit() == 30);
+    }
+
+    SECTION("Rendering") {
+        REQUIRE_THROWS_AS(canvas->start(), tgui::Exception);
+        REQUIRE(!canvas->isRunning());
+
+        // The render function shares ownership of the counter, so that it outlives the render thread even when a
+        // REQUIRE fails while the thread is still running
+        auto renderCount = std::make_shared<std::atomic<unsigned int>>(0);
+        canvas->setRenderFunction([renderCount](sf::RenderTarget& target){
+            target.clear(sf::Color::Green);
+            ++*renderCount;
+        });
+        canvas->setFrameRateLimit(0);
+
+        SECTION("Triple buffering") {
+        }
+
+        SECTION("Double buffering") {
+            canvas = std::make_shared<tgui::ThreadedCanvas>(tgui::Layout2d{100.f, 100.f}, 2);
+            canvas->setRenderFunction([renderCount](sf::RenderTarget& target){
+                target.clear(sf::Color::Green);
+                ++*renderCount;
+            });
+        }
+
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        parent->add(canvas);
+
+        canvas->start();
+        REQUIRE(canvas->isRunning());
+        REQUIRE(canvas->isUpdateRequired());
+        REQUIRE_THROWS_AS(canvas->setRenderFunction(nullptr), tgui::Exception);
+
+        // Keep drawing until the render thread has finished a few frames
+        sf::RenderTexture target;
+        target.create(100, 100);
+        for (unsigned int i = 0; (i < 10000) && (canvas->getCompletedFrameCount() < 3); ++i)
+        {
+            target.clear();
+            target.draw(*canvas);
+        }
+
+        canvas->stop();
+        REQUIRE(!canvas->isRunning());
+        REQUIRE(canvas->getCompletedFrameCount() >= 3);
+        REQUIRE(*renderCount == canvas->getCompletedFrameCount());
+
+        // Stopping twice is allowed and the canvas can be restarted
+        canvas->stop();
+        canvas->start();
+        REQUIRE(canvas->isRunning());
+
+        canvas->stop();
+        REQUIRE(!canvas->isRunning());
+    }
+
+    SECTION("Saving and loading from file") {
+        REQUIRE_NOTHROW(canvas = std::make_shared<tgui::ThreadedCanvas>(tgui::Layout2d{60.f, 40.f}));
+
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        parent->add(canvas);
+
+        canvas->setOpacity(0.8f);
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileThreadedCanvas1.txt"));
+
+        parent->removeAllWidgets();
+        REQUIRE_NOTHROW(parent->loadWidgetsFromFile("WidgetFileThreadedCanvas1.txt"));
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileThreadedCanvas2.txt"));
+        REQUIRE(compareFiles("WidgetFileThreadedCanvas1.txt", "WidgetFileThreadedCanvas2.txt"));
+
+        SECTION("Copying widget") {
+            tgui::ThreadedCanvas temp;
+            temp = *canvas;
+
+            parent->removeAllWidgets();
+            parent->add(tgui::ThreadedCanvas::copy(std::make_shared<tgui::ThreadedCanvas>(temp)));
+
+            REQUIRE_NOTHROW(parent->saveWidgetsToFile("WidgetFileThreadedCanvas2.txt"));
+            REQUIRE(compareFiles("WidgetFileThreadedCanvas1.txt", "WidgetFileThreadedCanvas2.txt"));
+        }
+    }
+}